@@ -0,0 +1,27 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using NUnit.Framework;
+    using Types;
+
+    internal sealed class AllocatorTest {
+
+        [Test(Description = @"Should reuse returned arrays and track live bytes")]
+        public void ReuseReturnedArray () {
+            var allocator = new PooledAllocator();
+            var first = allocator.Allocate<float>(16, AllocationCategory.Output);
+            allocator.Return(first, AllocationCategory.Output);
+            var second = allocator.Allocate<float>(16, AllocationCategory.Output);
+            var statistics = allocator.GetStatistics(AllocationCategory.Output);
+            Assert.AreSame(first, second);
+            Assert.AreEqual(2, statistics.allocations);
+            Assert.AreEqual(1, statistics.returns);
+            Assert.AreEqual(128, statistics.bytes);
+            Assert.AreEqual(64, statistics.liveBytes);
+        }
+    }
+}
\ No newline at end of file
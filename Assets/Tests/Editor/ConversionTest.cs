@@ -0,0 +1,83 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.Diagnostics;
+    using System.Linq;
+    using System.Numerics;
+    using NUnit.Framework;
+    using Types;
+    using Conversion = C.Conversion;
+
+    internal sealed unsafe class ConversionTest {
+
+        private static readonly (Dtype src, Dtype dst)[] Kernels = new [] {
+            (Dtype.Float16, Dtype.Float32),
+            (Dtype.Float32, Dtype.Float16),
+            (Dtype.BFloat16, Dtype.Float32),
+            (Dtype.Float32, Dtype.BFloat16),
+            (Dtype.Int8, Dtype.Float32),
+            (Dtype.Float32, Dtype.Int8),
+        };
+
+        [Test(Description = @"Should produce identical results with and without vectorization")]
+        public void MatchScalarConversion () {
+            var source = Enumerable.Range(0, 1 << 16).Select(i => (ushort)i).ToArray(); // every 16-bit pattern
+            var floats = new [] { 0f, -0f, 0.5f, 1.5f, 2.5f, -2.5f, 127.4f, 127.6f, -128.6f, 1e9f, float.NaN, float.PositiveInfinity }
+                .Concat(Enumerable.Range(0, 1000).Select(i => (i - 500) * 0.37f))
+                .ToArray();
+            var vectorized = Conversion.vectorized;
+            try {
+                fixed (ushort* bits = source)
+                fixed (float* data = floats) {
+                    Assert.AreEqual(Convert(Dtype.Float16, bits, Dtype.Float32, source.Length, false), Convert(Dtype.Float16, bits, Dtype.Float32, source.Length, true));
+                    Assert.AreEqual(Convert(Dtype.BFloat16, bits, Dtype.Float32, source.Length, false), Convert(Dtype.BFloat16, bits, Dtype.Float32, source.Length, true));
+                    Assert.AreEqual(Convert(Dtype.Int8, bits, Dtype.Float32, source.Length * 2, false), Convert(Dtype.Int8, bits, Dtype.Float32, source.Length * 2, true));
+                    Assert.AreEqual(Convert(Dtype.Float32, data, Dtype.Int8, floats.Length, false), Convert(Dtype.Float32, data, Dtype.Int8, floats.Length, true));
+                }
+            } finally {
+                Conversion.vectorized = vectorized;
+            }
+        }
+
+        [Test(Description = @"Should report conversion throughput with and without vectorization"), Explicit, Category("Benchmark")]
+        public void BenchmarkConversion () {
+            const int Count = 1 << 22;
+            const int Iterations = 20;
+            var src = new byte[Count * sizeof(float)];
+            var dst = new byte[Count * sizeof(float)];
+            var random = new Random(0);
+            random.NextBytes(src);
+            var vectorized = Conversion.vectorized;
+            TestContext.WriteLine($"Hardware accelerated: {Vector.IsHardwareAccelerated}, vector width: {Vector<byte>.Count * 8} bits");
+            try {
+                fixed (byte* input = src, output = dst)
+                    foreach (var (srcType, dstType) in Kernels)
+                        foreach (var mode in new [] { false, true }) {
+                            Conversion.vectorized = mode;
+                            Conversion.Convert(srcType, input, dstType, output, Count); // warm up
+                            var watch = Stopwatch.StartNew();
+                            for (var i = 0; i < Iterations; ++i)
+                                Conversion.Convert(srcType, input, dstType, output, Count);
+                            watch.Stop();
+                            var seconds = watch.Elapsed.TotalSeconds / Iterations;
+                            TestContext.WriteLine($"{srcType} -> {dstType} ({(mode ? "vector" : "scalar")}): {Count / seconds / 1e6:F1} Melem/s");
+                        }
+            } finally {
+                Conversion.vectorized = vectorized;
+            }
+        }
+
+        private static byte[] Convert (Dtype srcType, void* src, Dtype dstType, int count, bool vectorized) {
+            var result = new byte[count * sizeof(float)];
+            Conversion.vectorized = vectorized;
+            fixed (byte* dst = result)
+                Conversion.Convert(srcType, src, dstType, dst, count);
+            return result;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.Threading.Tasks;
+    using NUnit.Framework;
+    using API;
+    using Beta.Services;
+    using Services;
+    using Types;
+
+    internal sealed class HybridRoutingTest {
+
+        [Test(Description = @"Should only treat predictor load failures as unsupported")]
+        public void ClassifyLoadFailures () {
+            Assert.True(HybridPredictionService.IsUnsupported(new PredictorLoadException(@"@fxn/identity", new InvalidOperationException())));
+            Assert.True(HybridPredictionService.IsUnsupported(new DllNotFoundException()));
+            Assert.False(HybridPredictionService.IsUnsupported(new InvalidOperationException()));
+            Assert.False(HybridPredictionService.IsUnsupported(new ArgumentException()));
+            Assert.False(HybridPredictionService.IsUnsupported(new FunctionAPIException(@"Not found", 404)));
+        }
+
+        [Test(Description = @"Should load the predictor on-device before anything else")]
+        public void RouteFirstPredictionOnDevice () {
+            var state = new HybridPredictionService.State();
+            Assert.False(HybridPredictionService.Route(@"@fxn/identity", state).remote);
+        }
+
+        [Test(Description = @"Should route remotely while the on-device predictor is unavailable or backing off")]
+        public void RouteRemotelyAfterLoadFailure () {
+            var unavailable = new HybridPredictionService.State { localUnavailable = true };
+            Assert.True(HybridPredictionService.Route(@"@fxn/identity", unavailable).remote);
+            var backingOff = new HybridPredictionService.State();
+            backingOff.BackOff();
+            Assert.True(HybridPredictionService.Route(@"@fxn/identity", backingOff).remote);
+        }
+
+        [Test(Description = @"Should keep the first remote latency but skip the first on-device latency")]
+        public async Task RecordFirstRemoteLatency () {
+            var state = new HybridPredictionService.State();
+            await HybridPredictionService.Run(state.remote, () => Task.FromResult(new Prediction()));
+            await HybridPredictionService.Run(state.local, () => Task.FromResult(new Prediction()));
+            Assert.AreEqual(1, state.remote.latencies.Count);
+            Assert.AreEqual(0, state.local.latencies.Count);
+            Assert.True(state.local.loaded);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using NUnit.Framework;
+    using Types;
+
+    internal sealed unsafe class PixelFormatTest {
+
+        [Test(Description = @"Should swizzle a padded and flipped BGRA image to RGBA")]
+        public void ConvertBGRA () {
+            var data = new byte[] { // 2x2 BGRA, 12 byte rows, bottom to top
+                3, 2, 1, 255,   6, 5, 4, 255,   0, 0, 0, 0,
+                9, 8, 7, 255,   12, 11, 10, 255,   0, 0, 0, 0,
+            };
+            var image = new Image(data, 2, 2, PixelFormat.BGRA8888, 12, flip: true);
+            Assert.AreEqual(new byte[] { 7, 8, 9, 255, 10, 11, 12, 255, 1, 2, 3, 255, 4, 5, 6, 255 }, Convert(image));
+        }
+
+        [Test(Description = @"Should convert NV12 and NV21 images to RGB")]
+        public void ConvertSemiPlanar () {
+            var red = new byte[] { 255, 0, 0, 255, 0, 0, 255, 0, 0, 255, 0, 0 };
+            var nv12 = new byte[] { 81, 81, 81, 81, 90, 240 }; // BT.601 video range red
+            var nv21 = new byte[] { 81, 81, 81, 81, 240, 90 };
+            Assert.AreEqual(red, Convert(new Image(nv12, 2, 2, PixelFormat.NV12, 2)));
+            Assert.AreEqual(red, Convert(new Image(nv21, 2, 2, PixelFormat.NV21, 2)));
+        }
+
+        [Test(Description = @"Should convert an I420 image to RGB")]
+        public void ConvertPlanar () {
+            var data = new byte[] {
+                16, 16, 235, 235, // luma, black then white
+                16, 16, 235, 235,
+                128, 128,         // U
+                128, 128,         // V
+            };
+            var row = new byte[] { 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255 };
+            var expected = new byte[row.Length * 2];
+            row.CopyTo(expected, 0);
+            row.CopyTo(expected, row.Length);
+            Assert.AreEqual(expected, Convert(new Image(data, 4, 2, PixelFormat.I420, 4)));
+        }
+
+        [Test(Description = @"Should reject a native pixel buffer which is too small for the image")]
+        public void RejectShortNativeBuffer () {
+            var data = new byte[5];
+            fixed (byte* ptr = data) {
+                var address = (IntPtr)ptr;
+                Assert.Throws<ArgumentException>(() => new Image((byte*)address, 2, 2, PixelFormat.NV12, 2, data.Length));
+            }
+        }
+
+        private static byte[] Convert (Image image) {
+            var result = new byte[image.width * image.height * image.channels];
+            fixed (byte* dst = result)
+                image.CopyTo(dst);
+            return result;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using NUnit.Framework;
+    using Services;
+    using Types;
+
+    internal sealed class PredictionRecorderTest {
+
+        [Test(Description = @"Should report latency percentiles within the histogram resolution")]
+        public void ReportPercentiles () {
+            var recorder = new PredictionRecorder();
+            for (var i = 1; i <= 100; ++i) {
+                recorder.Start(null);
+                recorder.Complete(new Prediction { latency = i });
+            }
+            var statistics = recorder.GetStatistics(@"@fxn/identity");
+            Assert.AreEqual(100, statistics.predictions);
+            Assert.AreEqual(0, statistics.errors);
+            Assert.AreEqual(0, statistics.pending);
+            Assert.AreEqual(50.5, statistics.mean.Value, 1e-6);
+            Assert.AreEqual(50.0, statistics.p50.Value, 50.0 * 0.0625);
+            Assert.AreEqual(95.0, statistics.p95.Value, 95.0 * 0.0625);
+            Assert.AreEqual(99.0, statistics.p99.Value, 99.0 * 0.0625);
+            Assert.AreEqual(100.0, statistics.max.Value, 1e-6);
+            Assert.IsNull(statistics.firstOutput);
+        }
+
+        [Test(Description = @"Should report time to first output separately from streaming latency")]
+        public void ReportFirstOutput () {
+            var recorder = new PredictionRecorder();
+            recorder.Start(null);
+            recorder.FirstOutput(new Prediction { latency = 10 });
+            recorder.Complete(new Prediction { latency = 200 });
+            var statistics = recorder.GetStatistics(@"@fxn/identity");
+            Assert.AreEqual(10.0, statistics.firstOutput.Value, 1e-6);
+            Assert.AreEqual(200.0, statistics.max.Value, 1e-6);
+        }
+
+        [Test(Description = @"Should report no latencies before any prediction completes")]
+        public void ReportEmpty () {
+            var statistics = new PredictionRecorder().GetStatistics(@"@fxn/identity");
+            Assert.IsNull(statistics.mean);
+            Assert.IsNull(statistics.p50);
+            Assert.IsNull(statistics.max);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.IO;
+    using System.Text;
+    using NUnit.Framework;
+    using Internal;
+    using Types;
+
+    internal sealed class PredictorBundleTest {
+
+        private string directory;
+
+        [SetUp]
+        public void Before () => directory = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+
+        [TearDown]
+        public void After () {
+            if (Directory.Exists(directory))
+                Directory.Delete(directory, true);
+        }
+
+        [Test(Description = @"Should read back embedded predictions from a bundle")]
+        public void RoundTripBundle () {
+            var path = Path.Combine(directory, $"predictors{PredictorBundle.Extension}");
+            var prediction = new CachedPrediction {
+                tag = @"@fxn/identity",
+                clientId = @"linux-x86_64",
+                resources = new [] { new PredictionResource { type = @"bin", url = @"https://cdn.fxn.ai/resources/weights" } },
+            };
+            using (var writer = new PredictorBundle.Writer(path))
+                writer.Add(prediction, _ => new MemoryStream(new byte[] { 1, 2, 3 }));
+            var bundle = PredictorBundle.Open(path);
+            var result = bundle?.GetPrediction(prediction.tag, prediction.clientId);
+            Assert.NotNull(result);
+            Assert.AreEqual(new byte[] { 1, 2, 3 }, File.ReadAllBytes(new Uri(result.resources[0].url).LocalPath));
+        }
+
+        [Test(Description = @"Should resolve DSO resources to the framework directory instead of embedding them")]
+        public void ResolveFrameworkResources () {
+            var path = Path.Combine(directory, @"Resources", @"Data", @"StreamingAssets", $"predictors{PredictorBundle.Extension}");
+            var frameworkPath = Path.Combine(directory, @"Frameworks");
+            var dso = new PredictionResource { type = @"dso", url = @"https://cdn.fxn.ai/resources/library", name = @"libPredictor.dylib" };
+            var prediction = new CachedPrediction {
+                tag = @"@fxn/identity",
+                clientId = @"macos-arm64",
+                resources = new [] { dso },
+            };
+            using (var writer = new PredictorBundle.Writer(path, frameworkPath))
+                writer.Add(prediction, _ => throw new InvalidOperationException(@"DSO resources should not be embedded"));
+            var bundle = PredictorBundle.Open(path);
+            Assert.IsNull(bundle?.GetPrediction(prediction.tag, prediction.clientId));
+            Directory.CreateDirectory(frameworkPath);
+            File.WriteAllBytes(Path.Combine(frameworkPath, PredictorBundle.GetFrameworkName(dso)), new byte[] { 1 });
+            var result = bundle?.GetPrediction(prediction.tag, prediction.clientId);
+            Assert.NotNull(result);
+            Assert.AreEqual(Path.Combine(Path.GetFullPath(frameworkPath), @"libPredictor.dylib"), new Uri(result.resources[0].url).LocalPath);
+        }
+
+        [Test(Description = @"Should ignore a truncated bundle")]
+        public void RejectTruncatedBundle () => Assert.IsNull(Open(Header(Magic, Version, 64), Encoding.UTF8.GetBytes(@"{""predictions"":")));
+
+        [Test(Description = @"Should ignore a bundle with an unknown magic")]
+        public void RejectBadMagic () => Assert.IsNull(Open(Header(0xDEADBEEF, Version, 2), Encoding.UTF8.GetBytes(@"{}")));
+
+        [Test(Description = @"Should ignore a bundle with a negative manifest length")]
+        public void RejectNegativeManifestLength () => Assert.IsNull(Open(Header(Magic, Version, -1)));
+
+        [Test(Description = @"Should ignore a bundle with a null manifest")]
+        public void RejectNullManifest () => Assert.IsNull(Open(Header(Magic, Version, 4), Encoding.UTF8.GetBytes(@"null")));
+
+        private const uint Magic = 0x424E5846; // 'FXNB'
+        private const uint Version = 2;
+
+        private PredictorBundle Open (params byte[][] chunks) {
+            var path = Path.Combine(directory, $"predictors{PredictorBundle.Extension}");
+            Directory.CreateDirectory(directory);
+            using (var stream = File.Create(path))
+                foreach (var chunk in chunks)
+                    stream.Write(chunk, 0, chunk.Length);
+            return PredictorBundle.Open(path);
+        }
+
+        private static byte[] Header (uint magic, uint version, long manifestLength) {
+            using var stream = new MemoryStream();
+            using (var writer = new BinaryWriter(stream)) {
+                writer.Write(magic);
+                writer.Write(version);
+                writer.Write(manifestLength);
+            }
+            return stream.ToArray();
+        }
+    }
+}
\ No newline at end of file
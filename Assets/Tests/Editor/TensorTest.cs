@@ -0,0 +1,59 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using NUnit.Framework;
+    using Types;
+    using Value = C.Value;
+
+    internal sealed class TensorTest {
+
+        [Test(Description = @"Should create a value from a transposed tensor")]
+        public void CreateTransposedValue () {
+            var data = new float[] { 1, 2, 3, 4, 5, 6 }; // 2x3
+            var transposed = new Tensor<float>(data, new [] { 3, 2 }, new [] { 1, 3 });
+            using var value = Value.CreateArray(transposed);
+            var result = (Tensor<float>)value.ToObject()!;
+            Assert.AreEqual(new [] { 3, 2 }, result.shape);
+            Assert.AreEqual(new float[] { 1, 4, 2, 5, 3, 6 }, result.data);
+        }
+
+        [Test(Description = @"Should create a value from a cropped tensor")]
+        public void CreateCroppedValue () {
+            var data = new float[] { 1, 2, 3, 4, 5, 6, 7, 8, 9 }; // 3x3
+            var crop = new Tensor<float>(data, new [] { 2, 2 }, new [] { 3, 1 });
+            using var value = Value.CreateArray(crop);
+            var result = (Tensor<float>)value.ToObject()!;
+            Assert.AreEqual(new float[] { 1, 2, 4, 5 }, result.data);
+        }
+
+        [Test(Description = @"Should create a value from an offset tensor view")]
+        public void CreateOffsetValue () {
+            var data = new float[] { 1, 2, 3, 4, 5, 6, 7, 8, 9 }; // 3x3
+            var rows = new Tensor<float>(data, new [] { 2, 3 }, new [] { 3, 1 }, 3);
+            using var value = Value.CreateArray(rows);
+            var result = (Tensor<float>)value.ToObject()!;
+            Assert.AreEqual(new float[] { 4, 5, 6, 7, 8, 9 }, result.data);
+        }
+
+        [Test(Description = @"Should copy only the elements of a contiguous view over a larger array")]
+        public void ContiguousViewToArray () {
+            var data = new float[] { 1, 2, 3, 4, 5, 6, 7, 8, 9 }; // 3x3
+            var rows = new Tensor<float>(data, new [] { 2, 3 }, new [] { 3, 1 });
+            Assert.AreEqual(new float[] { 1, 2, 3, 4, 5, 6 }, rows.ToArray());
+            var whole = new Tensor<float>(data, new [] { 3, 3 });
+            Assert.AreSame(data, whole.ToArray());
+        }
+
+        [Test(Description = @"Should reject strides which reach past the end of the tensor data")]
+        public void RejectOutOfRangeStrides () {
+            var data = new float[] { 1, 2, 3, 4, 5, 6 }; // 2x3
+            Assert.Throws<System.ArgumentOutOfRangeException>(() => new Tensor<float>(data, new [] { 2, 3 }, new [] { 4, 1 }));
+            Assert.Throws<System.ArgumentOutOfRangeException>(() => new Tensor<float>(data, new [] { 2, 3 }, new [] { 3, 1 }, 1));
+            Assert.Throws<System.ArgumentOutOfRangeException>(() => new Tensor<float>(data, new [] { 2, 3 }, new [] { 3, 1 }, -1));
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System.IO;
+    using System.Linq;
+    using System.Runtime.InteropServices;
+    using System.Text;
+    using NUnit.Framework;
+    using Types;
+    using Value = C.Value;
+    using ValueMap = C.ValueMap;
+
+    internal sealed class ValueTest {
+
+        [Test(Description = @"Should invoke the deallocator when the value is released")]
+        public unsafe void ReleaseValueDeallocator () {
+            var buffer = Marshal.AllocHGlobal(4 * sizeof(float));
+            var released = false;
+            var value = Value.CreateArray(
+                new Tensor<float>((float*)buffer, new [] { 4 }),
+                () => { Marshal.FreeHGlobal(buffer); released = true; }
+            );
+            Assert.False(released);
+            value.Dispose();
+            Assert.True(released);
+        }
+
+        [Test(Description = @"Should keep a borrowed managed array pinned across garbage collections")]
+        public void PinBorrowedManagedArray () {
+            var data = new [] { 1f, 2f, 3f, 4f };
+            var released = false;
+            using (var value = Value.CreateArray(new Tensor<float>(data, new [] { 4 }), () => released = true)) {
+                for (var i = 0; i < 16; ++i)
+                    _ = new byte[64 * 1024];
+                System.GC.Collect();
+                System.GC.WaitForPendingFinalizers();
+                System.GC.Collect();
+                var tensor = (Tensor<float>)value.ToObject();
+                Assert.AreEqual(data, tensor.data);
+                Assert.False(released);
+            }
+            Assert.True(released);
+        }
+
+        [Test(Description = @"Should invoke the deallocator when the owning value map is released")]
+        public unsafe void ReleaseValueMapDeallocator () {
+            var buffer = Marshal.AllocHGlobal(4 * sizeof(float));
+            var released = false;
+            using (var map = new ValueMap()) {
+                map["input"] = Value.CreateArray(
+                    new Tensor<float>((float*)buffer, new [] { 4 }),
+                    () => { Marshal.FreeHGlobal(buffer); released = true; }
+                );
+                Assert.False(released);
+            }
+            Assert.True(released);
+        }
+
+        [Test(Description = @"Should create a binary value from the remainder of a memory stream and consume it")]
+        public void CreateBinaryFromMemoryStream () {
+            using var stream = new MemoryStream(new byte[] { 0, 1, 2, 3, 4, 5 }, 0, 6, false, true);
+            stream.Position = 2;
+            using var value = Value.CreateBinary(stream);
+            using var result = (MemoryStream)value.ToObject();
+            Assert.AreEqual(new byte[] { 2, 3, 4, 5 }, result.ToArray());
+            Assert.AreEqual(stream.Length, stream.Position);
+            using var empty = Value.CreateBinary(stream);
+            using var emptyResult = (MemoryStream)empty.ToObject();
+            Assert.AreEqual(0, emptyResult.Length);
+        }
+
+        [Test(Description = @"Should create a binary value from a range of a file")]
+        public void CreateBinaryFromFile () {
+            var path = Path.GetTempFileName();
+            try {
+                File.WriteAllBytes(path, new byte[] { 0, 1, 2, 3, 4, 5, 6, 7 });
+                using var value = Value.CreateBinary(path, 2, 4);
+                using var stream = (MemoryStream)value.ToObject();
+                Assert.AreEqual(new byte[] { 2, 3, 4, 5 }, stream.ToArray());
+            } finally {
+                File.Delete(path);
+            }
+        }
+
+        [Test(Description = @"Should create an array value from an npy file")]
+        public void CreateArrayFromNpy () {
+            var path = Path.GetTempFileName();
+            try {
+                var header = @"{'descr': '<f4', 'fortran_order': False, 'shape': (2, 3), }";
+                header = header.PadRight(64 - 10 - 1) + "\n";
+                using (var stream = File.Create(path))
+                    using (var writer = new BinaryWriter(stream)) {
+                        writer.Write(new byte[] { 0x93, (byte)'N', (byte)'U', (byte)'M', (byte)'P', (byte)'Y', 1, 0 });
+                        writer.Write((ushort)header.Length);
+                        writer.Write(Encoding.ASCII.GetBytes(header));
+                        foreach (var x in Enumerable.Range(0, 6))
+                            writer.Write((float)x);
+                    }
+                using var value = Value.CreateArrayFromNpy(path);
+                var tensor = (Tensor<float>)value.ToObject();
+                Assert.AreEqual(new [] { 2, 3 }, tensor.shape);
+                Assert.AreEqual(new [] { 0f, 1f, 2f, 3f, 4f, 5f }, tensor.data);
+            } finally {
+                File.Delete(path);
+            }
+        }
+
+        [Test(Description = @"Should round trip a tensor through a half-precision value")]
+        public void ConvertFloat16Value () {
+            var data = new [] { 0f, 1f, -2f, 0.5f, 65504f, float.PositiveInfinity };
+            using var value = Value.CreateArray(new Tensor<float>(data, new [] { 2, 3 }), Dtype.Float16);
+            Assert.AreEqual(Dtype.Float16, value.type);
+            using var converted = value.Convert(Dtype.Float32);
+            var tensor = (Tensor<float>)converted.ToObject();
+            Assert.AreEqual(new [] { 2, 3 }, tensor.shape);
+            Assert.AreEqual(data, tensor.data);
+        }
+
+        [Test(Description = @"Should convert a transposed tensor through its strides")]
+        public void ConvertStridedInt8Value () {
+            var data = new [] { 1f, 2f, 3f, 4f, 5f, 6f }; // 2x3, read as its 3x2 transpose
+            using var value = Value.CreateArray(new Tensor<float>(data, new [] { 3, 2 }, new [] { 1, 3 }), Dtype.Int8);
+            var tensor = (Tensor<sbyte>)value.ToObject();
+            Assert.AreEqual(new [] { 3, 2 }, tensor.shape);
+            Assert.AreEqual(new sbyte[] { 1, 4, 2, 5, 3, 6 }, tensor.data);
+        }
+
+        [Test(Description = @"Should create and read back a half-precision tensor without widening")]
+        public void CreateFloat16Value () {
+            var data = new [] { 1.5f, -0.25f, 1e-7f, 70000f }.Select(x => (Float16)x).ToArray();
+            using var value = Value.CreateArray(new Tensor<Float16>(data, new [] { 4 }));
+            Assert.AreEqual(Dtype.Float16, value.type);
+            var tensor = (Tensor<Float16>)value.ToObject();
+            Assert.AreEqual(data, tensor.data);
+            Assert.AreEqual(new [] { 1.5f, -0.25f, 1.1920929e-7f, float.PositiveInfinity }, tensor.data.Select(x => (float)x).ToArray());
+        }
+
+        [Test(Description = @"Should convert a padded and flipped BGRA image when creating a value")]
+        public void CreateStridedBGRAImage () {
+            var data = new byte[] { // 2x2 BGRA, 12 byte rows, bottom to top
+                3, 2, 1, 255,   6, 5, 4, 255,   0, 0, 0, 0,
+                9, 8, 7, 255,   12, 11, 10, 255,   0, 0, 0, 0,
+            };
+            var image = new Image(data, 2, 2, PixelFormat.BGRA8888, 12, flip: true);
+            using var value = Value.CreateImage(image);
+            var result = (Image)value.ToObject();
+            Assert.AreEqual(4, result.channels);
+            Assert.AreEqual(new byte[] { 7, 8, 9, 255, 10, 11, 12, 255, 1, 2, 3, 255, 4, 5, 6, 255 }, result.data);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.IO;
+    using System.IO.Compression;
+    using System.Linq;
+    using System.Runtime.InteropServices;
+    using System.Text;
+    using System.Threading.Tasks;
+    using Newtonsoft.Json;
+    using UnityEngine;
+    using API;
+    using Debug = UnityEngine.Debug;
+    using Random = System.Random;
+
+    internal sealed class CompressionTest : MonoBehaviour {
+
+        public int elements = 256 * 1024;
+        public int threshold = 1024;
+
+        private async void Start () {
+            using var server = new LocalServer(async context => {
+                Stream body = context.Request.InputStream;
+                if (context.Request.Headers[@"Content-Encoding"] == @"gzip")
+                    body = new GZipStream(body, CompressionMode.Decompress);
+                await body.CopyToAsync(Stream.Null);
+            });
+            var client = new DotNetClient(server.url);
+            var sent = 0L;
+            client.OnRequestCompleted += metrics => sent = metrics.bytesSent;
+            var random = new Random(0);
+            var payloads = new Dictionary<string, float[]> {
+                [@"zeros"] = new float[elements],
+                [@"smooth"] = Enumerable.Range(0, elements).Select(i => MathF.Sin(i * 1e-3f)).ToArray(),
+                [@"noise"] = Enumerable.Range(0, elements).Select(_ => (float)random.NextDouble()).ToArray(),
+            };
+            foreach (var pair in payloads) {
+                var data = MemoryMarshal.AsBytes(pair.Value.AsSpan()).ToArray();
+                var payload = new Dictionary<string, object> {
+                    [@"data"] = $"data:application/octet-stream;base64,{Convert.ToBase64String(data)}"
+                };
+                client.compressionThreshold = null;
+                await client.Request<Dictionary<string, object>>(@"POST", @"/", payload);
+                var uncompressed = sent;
+                client.compressionThreshold = threshold;
+                var watch = Stopwatch.StartNew();
+                await client.Request<Dictionary<string, object>>(@"POST", @"/", payload);
+                var compressed = sent;
+                Debug.Log(
+                    $"Payload '{pair.Key}': {uncompressed / 1e+3:F1}KB uncompressed, {compressed / 1e+3:F1}KB compressed " +
+                    $"({100.0 * (uncompressed - compressed) / uncompressed:F1}% saved) in {watch.Elapsed.TotalMilliseconds:F1}ms " +
+                    $"including {CompressionTime(payload):F1}ms compressing"
+                );
+            }
+        }
+
+        private static double CompressionTime (Dictionary<string, object> payload) {
+            var data = Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(payload));
+            var watch = Stopwatch.StartNew();
+            using var stream = new MemoryStream();
+            using (var gzip = new GZipStream(stream, CompressionLevel.Fastest, true))
+                gzip.Write(data, 0, data.Length);
+            return watch.Elapsed.TotalMilliseconds;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.Linq;
+    using System.Text;
+    using System.Threading.Tasks;
+    using UnityEngine;
+    using API;
+    using Debug = UnityEngine.Debug;
+
+    internal sealed class ConcurrentRequestTest : MonoBehaviour {
+
+        public int requests = 100;
+        public int responseDelay = 2000;
+        private readonly List<float> frameTimes = new();
+
+        private async void Start () {
+            QualitySettings.vSyncCount = 0;
+            Application.targetFrameRate = -1;
+            using var server = new LocalServer(async context => {
+                await Task.Delay(responseDelay);
+                var data = Encoding.UTF8.GetBytes(@"{}");
+                context.Response.ContentType = @"application/json";
+                await context.Response.OutputStream.WriteAsync(data, 0, data.Length);
+            });
+            var client = new UnityClient(server.url, null);
+            // Baseline
+            await Task.Delay(1000);
+            var baseline = frameTimes.Average();
+            frameTimes.Clear();
+            // Benchmark
+            var watch = Stopwatch.StartNew();
+            await Task.WhenAll(Enumerable.Range(0, requests).Select(_ => client.Request<Dictionary<string, object>>(@"GET", @"/")));
+            watch.Stop();
+            var loaded = frameTimes.Average();
+            Debug.Log($"Completed {requests} concurrent requests in {watch.Elapsed.TotalMilliseconds:F1}ms");
+            Debug.Log($"Mean frame time: {baseline:F3}ms idle, {loaded:F3}ms with requests in flight");
+        }
+
+        private void Update () => frameTimes.Add(Time.unscaledDeltaTime * 1e+3f);
+    }
+}
\ No newline at end of file
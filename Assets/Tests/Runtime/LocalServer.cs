@@ -0,0 +1,51 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.Net;
+    using System.Threading.Tasks;
+
+    /// <summary>
+    /// Local stand-in server for benchmarking API clients without a network.
+    /// </summary>
+    internal sealed class LocalServer : IDisposable {
+
+        public readonly string url;
+
+        public LocalServer (Func<HttpListenerContext, Task> handler, int port = 8095) {
+            this.url = $"http://localhost:{port}";
+            this.handler = handler;
+            this.listener = new HttpListener();
+            listener.Prefixes.Add($"{url}/");
+            listener.Start();
+            Task.Run(Serve);
+        }
+
+        public void Dispose () => listener.Close();
+
+        private readonly HttpListener listener;
+        private readonly Func<HttpListenerContext, Task> handler;
+
+        private async Task Serve () {
+            while (listener.IsListening) {
+                HttpListenerContext context;
+                try {
+                    context = await listener.GetContextAsync();
+                } catch (Exception) {
+                    return;
+                }
+                _ = Task.Run(async () => {
+                    try {
+                        await handler(context);
+                    } finally {
+                        context.Response.Close();
+                    }
+                });
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.Collections.Concurrent;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.IO;
+    using System.Net;
+    using System.Text;
+    using System.Threading.Tasks;
+    using Newtonsoft.Json;
+    using Newtonsoft.Json.Linq;
+    using UnityEngine;
+    using API;
+    using Types;
+    using Debug = UnityEngine.Debug;
+
+    internal sealed class RemotePayloadTest : MonoBehaviour {
+
+        public int[] shape = new [] { 1, 3, 1024, 1024 };
+        public int iterations = 5;
+        private readonly ConcurrentDictionary<string, byte[]> values = new();
+
+        private async void Start () {
+            using var server = new LocalServer(Handle);
+            var fxn = new Function(new UnityClient(server.url, null));
+            var tensor = new Tensor<float>(new float[shape[0] * shape[1] * shape[2] * shape[3]], shape);
+            // Inline
+            fxn.Beta.Predictions.Remote.maxDataUrlSize = int.MaxValue;
+            var inline = await Benchmark(fxn, tensor);
+            // Binary
+            fxn.Beta.Predictions.Remote.maxDataUrlSize = 0;
+            var binary = await Benchmark(fxn, tensor);
+            Debug.Log($"Remote prediction with {tensor.data.Length * sizeof(float) / 1e+6:F1}MB tensor: {inline:F1}ms inline, {binary:F1}ms binary");
+        }
+
+        private async Task<double> Benchmark (Function fxn, Tensor<float> tensor) {
+            var watch = Stopwatch.StartNew();
+            for (var i = 0; i < iterations; ++i) {
+                var prediction = await fxn.Beta.Predictions.Remote.Create(@"@test/echo", new () { [@"input"] = tensor });
+                var result = (Tensor<float>)prediction.results![0]!;
+                if (result.data.Length != tensor.data.Length)
+                    throw new InvalidOperationException(@"Echoed tensor does not match input tensor");
+            }
+            return watch.Elapsed.TotalMilliseconds / iterations;
+        }
+
+        private async Task Handle (HttpListenerContext context) {
+            var request = context.Request;
+            var response = context.Response;
+            var path = request.Url.AbsolutePath;
+            using var body = new MemoryStream();
+            await request.InputStream.CopyToAsync(body);
+            byte[] result = null;
+            if (path == @"/values") {
+                var id = Guid.NewGuid().ToString("N");
+                var url = $"{request.Url.GetLeftPart(UriPartial.Authority)}/blobs/{id}";
+                result = Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(new { uploadUrl = url, downloadUrl = url }));
+            } else if (path.StartsWith(@"/blobs/") && request.HttpMethod == @"PUT")
+                values[path] = body.ToArray();
+            else if (path.StartsWith(@"/blobs/"))
+                result = values[path];
+            else if (path == @"/predictions/remote") {
+                var payload = JObject.Parse(Encoding.UTF8.GetString(body.ToArray()));
+                var prediction = new JObject {
+                    [@"id"] = Guid.NewGuid().ToString("N"),
+                    [@"tag"] = payload[@"tag"],
+                    [@"created"] = DateTime.UtcNow,
+                    [@"results"] = new JArray(payload[@"inputs"]![@"input"]!),
+                    [@"latency"] = 0,
+                };
+                result = Encoding.UTF8.GetBytes(prediction.ToString(Formatting.None));
+            }
+            if (result != null)
+                await response.OutputStream.WriteAsync(result, 0, result.Length);
+        }
+    }
+}
\ No newline at end of file
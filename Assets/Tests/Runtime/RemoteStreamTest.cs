@@ -0,0 +1,52 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.Diagnostics;
+    using System.Text;
+    using System.Threading.Tasks;
+    using Newtonsoft.Json;
+    using Newtonsoft.Json.Linq;
+    using UnityEngine;
+    using API;
+    using Debug = UnityEngine.Debug;
+
+    internal sealed class RemoteStreamTest : MonoBehaviour {
+
+        public string text = @"The quick brown fox jumps over the lazy dog";
+        public int tokenDelay = 100;
+
+        private async void Start () {
+            using var server = new LocalServer(async context => {
+                context.Response.ContentType = @"text/event-stream";
+                var words = text.Split(' ');
+                for (var i = 0; i < words.Length; ++i) {
+                    var data = Encoding.UTF8.GetBytes(words[i]);
+                    var prediction = new JObject {
+                        [@"id"] = Guid.NewGuid().ToString("N"),
+                        [@"tag"] = @"@test/stream",
+                        [@"created"] = DateTime.UtcNow,
+                        [@"results"] = new JArray(new JObject {
+                            [@"data"] = $"data:text/plain;base64,{Convert.ToBase64String(data)}",
+                            [@"type"] = @"string",
+                        }),
+                        [@"latency"] = 0,
+                    };
+                    var eventData = Encoding.UTF8.GetBytes($"event: prediction\ndata: {prediction.ToString(Formatting.None)}\n\n");
+                    await context.Response.OutputStream.WriteAsync(eventData, 0, eventData.Length);
+                    await context.Response.OutputStream.FlushAsync();
+                    await Task.Delay(tokenDelay);
+                }
+            });
+            var fxn = new Function(new UnityClient(server.url, null));
+            var watch = Stopwatch.StartNew();
+            var stream = fxn.Beta.Predictions.Remote.Stream(@"@test/stream", new ());
+            await foreach (var prediction in stream)
+                Debug.Log($"Received '{prediction.results![0]}' after {watch.Elapsed.TotalMilliseconds:F1}ms");
+        }
+    }
+}
\ No newline at end of file
@@ -12,14 +12,18 @@ namespace Function.Editor.Build {
 
     using System;
     using System.Collections.Generic;
+    using System.Diagnostics;
     using System.IO;
     using System.Linq;
     using System.Reflection;
+    using System.Threading.Tasks;
     using UnityEditor;
     using UnityEditor.Build;
     using UnityEditor.Build.Reporting;
     using UnityEngine;
     using Internal;
+    using Types;
+    using Debug = UnityEngine.Debug;
 
     internal abstract class BuildHandler : IPreprocessBuildWithReport {
     
@@ -36,8 +40,7 @@ namespace Function.Editor.Build {
         protected abstract FunctionSettings CreateSettings (BuildReport report);
 
         internal static Embed[] GetEmbeds () {
-            var assemblies = AppDomain.CurrentDomain.GetAssemblies();
-            var types = assemblies.SelectMany(assembly => assembly.GetTypes()).ToArray();
+            var (types, properties) = DiscoverEmbeds();
             var defaultEmbeds = types
                 .SelectMany(type => Attribute.GetCustomAttributes(type, typeof(EmbedAttribute)))
                 .Cast<EmbedAttribute>()
@@ -47,20 +50,7 @@ namespace Function.Editor.Build {
                     tags = embed.tags
                 })
                 .ToArray();
-            var customEmbeds = types
-                .SelectMany(type => { // thanks Jamie!
-                    try {
-                        return type.GetProperties(BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Static);
-                    }
-                    catch (Exception ex) {
-                        Debug.LogWarning($"Function: Failed to inspect type {type} for predictor embeds with exception: {ex.Message}. Predictions might fail at runtime.");
-                        return new PropertyInfo[0];
-                    }
-                })
-                .Where(property =>
-                    Attribute.IsDefined(property, typeof(EmbedAttribute)) &&
-                    property.PropertyType == typeof(FunctionClient)
-                )
+            var customEmbeds = properties
                 .Select(property  => {
                     var attribute = property.GetCustomAttribute<EmbedAttribute>();
                     var getter = CreateDelegateForProperty<FunctionClient>(property);
@@ -79,6 +69,8 @@ namespace Function.Editor.Build {
 
         #region --Operations--
         protected const string CachePath = @"Assets/__FXN_DELETE_THIS__";
+        private static Type[]? embedTypes;
+        private static PropertyInfo[]? embedProperties;
 
         void IPreprocessBuildWithReport.OnPreprocessBuild (BuildReport report) {
             if (!targets.Contains(report.summary.platform))
@@ -117,6 +109,100 @@ namespace Function.Editor.Build {
             AssetDatabase.DeleteAsset(CachePath);
         }
 
+        protected static List<CachedPrediction> CreateCachedPredictions (Embed[] embeds, string[] clientIds) {
+            var cache = new List<CachedPrediction>();
+            foreach (var embed in embeds) {
+                var client = new API.DotNetClient(embed.url, embed.accessKey);
+                var fxn = new FunctionClient(client);
+                foreach (var tag in embed.tags)
+                    foreach (var clientId in clientIds) {
+                        try {
+                            var prediction = Task.Run(() => fxn.Predictions.Create(
+                                tag,
+                                clientId: clientId,
+                                configurationId: @""
+                            )).Result;
+                            cache.Add(new CachedPrediction(prediction, clientId));
+                        } catch (AggregateException ex) {
+                            Debug.LogWarning($"Function: Failed to embed {tag} predictor with error: {ex.InnerException}. Predictions with this predictor will likely fail at runtime.");
+                        }
+                    }
+            }
+            return cache;
+        }
+
+        protected static string GetStandaloneClientId (BuildTarget target, string platform) {
+            var architecture = EditorUserBuildSettings.GetPlatformSettings(
+                BuildPipeline.GetBuildTargetName(target),
+                @"Architecture"
+            );
+            var arm64 = string.Equals(architecture, @"ARM64", StringComparison.OrdinalIgnoreCase);
+            return $"{platform}-{(arm64 ? @"arm64" : @"x86_64")}";
+        }
+
+        protected static void EmbedResources (
+            List<CachedPrediction> cache,
+            string streamingAssetsPath,
+            string? frameworkPath = null
+        ) {
+            var bundlePath = API.PredictionCacheClient.GetEmbedBundlePath(streamingAssetsPath);
+            var client = new API.DotNetClient(FunctionClient.URL);
+            using var bundle = new PredictorBundle.Writer(bundlePath, frameworkPath);
+            foreach (var prediction in cache) {
+                try {
+                    bundle.Add(prediction, resource => Task.Run(() => client.Download(resource.url)).Result);
+                } catch (AggregateException ex) {
+                    Debug.LogWarning($"Function: Failed to embed prediction resources for {prediction.tag} predictor with error: {ex.InnerException}. Predictions with this predictor will download resources at runtime.");
+                }
+            }
+        }
+
+        private static (Type[] types, PropertyInfo[] properties) DiscoverEmbeds () {
+            // Check cache
+            if (embedTypes != null && embedProperties != null)
+                return (embedTypes, embedProperties);
+            // Types are indexed by the editor so this is effectively free
+            var watch = Stopwatch.StartNew();
+            var types = TypeCache.GetTypesWithAttribute<EmbedAttribute>().ToArray();
+            // Properties are not indexed, so only inspect assemblies that can reference the attribute
+            var runtimeAssembly = typeof(EmbedAttribute).Assembly;
+            var runtimeAssemblyName = runtimeAssembly.GetName().Name;
+            var properties = AppDomain.CurrentDomain.GetAssemblies()
+                .Where(assembly =>
+                    assembly == runtimeAssembly ||
+                    assembly.GetReferencedAssemblies().Any(name => name.Name == runtimeAssemblyName)
+                )
+                .SelectMany(GetLoadableTypes)
+                .SelectMany(type => { // thanks Jamie!
+                    try {
+                        return type.GetProperties(BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Static | BindingFlags.DeclaredOnly);
+                    }
+                    catch (Exception ex) {
+                        Debug.LogWarning($"Function: Failed to inspect type {type} for predictor embeds with exception: {ex.Message}. Predictions might fail at runtime.");
+                        return new PropertyInfo[0];
+                    }
+                })
+                .Where(property =>
+                    property.PropertyType == typeof(FunctionClient) &&
+                    Attribute.IsDefined(property, typeof(EmbedAttribute))
+                )
+                .ToArray();
+            watch.Stop();
+            Debug.Log($"Function: Discovered {types.Length + properties.Length} predictor embeds in {watch.Elapsed.TotalMilliseconds:F1}ms");
+            // Cache until the next domain reload
+            embedTypes = types;
+            embedProperties = properties;
+            return (types, properties);
+        }
+
+        private static Type[] GetLoadableTypes (Assembly assembly) {
+            try {
+                return assembly.GetTypes();
+            } catch (ReflectionTypeLoadException ex) {
+                return ex.Types.Where(type => type != null).ToArray()!;
+            }
+        }
+
         private static Func<T>? CreateDelegateForProperty<T> (PropertyInfo property) {
             var getter = property.GetGetMethod(true);
             return getter != null && getter.ReturnType == typeof(T) ?
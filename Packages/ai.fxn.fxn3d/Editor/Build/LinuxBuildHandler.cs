@@ -5,11 +5,18 @@
 
 namespace Function.Editor.Build {
 
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
     using UnityEditor;
+    using UnityEditor.Build;
     using UnityEditor.Build.Reporting;
+    using Types;
     using FunctionSettings = Internal.FunctionSettings;
 
-    internal sealed class LinuxBuildHandler : BuildHandler {
+    internal sealed class LinuxBuildHandler : BuildHandler, IPostprocessBuildWithReport {
+
+        private List<CachedPrediction> cache;
 
         protected override BuildTarget[] targets => new [] {
             BuildTarget.StandaloneLinux64,
@@ -20,7 +27,28 @@ namespace Function.Editor.Build {
         protected override FunctionSettings CreateSettings (BuildReport report) {
             var projectSettings = FunctionProjectSettings.instance;
             var settings = FunctionSettings.Create(projectSettings.accessKey);
+            if (!projectSettings.embedResources)
+                return settings;
+            var clientId = GetStandaloneClientId(report.summary.platform, @"linux");
+            var cache = CreateCachedPredictions(GetEmbeds(), new [] { clientId });
+            settings.cache = cache;
+            this.cache = cache;
             return settings;
         }
+
+        void IPostprocessBuildWithReport.OnPostprocessBuild (BuildReport report) {
+            if (!targets.Contains(report.summary.platform))
+                return;
+            if (cache == null)
+                return;
+            var outputPath = report.summary.outputPath;
+            var streamingAssetsPath = Path.Combine(
+                Path.GetDirectoryName(outputPath),
+                $"{Path.GetFileNameWithoutExtension(outputPath)}_Data",
+                @"StreamingAssets"
+            );
+            EmbedResources(cache, streamingAssetsPath);
+            cache = null;
+        }
     }
 }
\ No newline at end of file
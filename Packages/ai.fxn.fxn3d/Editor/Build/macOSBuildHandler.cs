@@ -15,9 +15,9 @@ namespace Function.Editor.Build {
     using UnityEditor.Build;
     using UnityEditor.Build.Reporting;
     using API;
-    using Services;
     using Types;
     using FunctionSettings = Internal.FunctionSettings;
+    using PredictorBundle = Internal.PredictorBundle;
 
     #if UNITY_STANDALONE_OSX
     using UnityEditor.iOS.Xcode;
@@ -39,30 +39,7 @@ namespace Function.Editor.Build {
             var projectSettings = FunctionProjectSettings.instance;
             var settings = FunctionSettings.Create(projectSettings.accessKey);
             // Embed predictors
-            var embeds = GetEmbeds();
-            var cache = new List<CachedPrediction>();
-            foreach (var embed in embeds) {
-                var client = new DotNetClient(embed.url, embed.accessKey);
-                var fxn = new Function(client);
-                var predictions = (from tag in embed.tags from clientId in ClientIds select (clientId, tag))
-                    .Select((pair) => {
-                        var (clientId, tag) = pair;
-                        try {
-                            var prediction = Task.Run(() => fxn.Predictions.Create(
-                                tag,
-                                clientId: clientId,
-                                configurationId: @""
-                            )).Result;
-                            return new CachedPrediction(prediction, clientId);
-                        } catch (AggregateException ex) {
-                            Debug.LogWarning($"Function: Failed to embed {tag} predictor with error: {ex.InnerException}. Predictions with this predictor will likely fail at runtime.");
-                            return null;
-                        }
-                    })
-                    .Where(pred => pred != null)
-                    .ToArray();
-                cache.AddRange(predictions);
-            }
+            var cache = CreateCachedPredictions(GetEmbeds(), ClientIds);
             // Cache
             settings.cache = cache;
             this.cache = cache;
@@ -92,7 +69,7 @@ namespace Function.Editor.Build {
                     try {
                         if (resource.type != @"dso")
                             continue;
-                        var dsoName = Path.GetFileName(PredictionService.GetResourcePath(resource, outputPath));
+                        var dsoName = PredictorBundle.GetFrameworkName(resource);
                         var dsoPath = Path.Combine(frameworkDir, dsoName);
                         using var dsoStream = Task.Run(() => client.Download(resource.url)).Result;
                         using var fileStream = File.Create(dsoPath);
@@ -102,9 +79,18 @@ namespace Function.Editor.Build {
                         Debug.LogWarning($"Function: Failed to embed prediction resource for {prediction.tag} predictor with error: {ex.InnerException}. Predictions with this predictor will likely fail at runtime.");
                     }
                 }
+            // Embed remaining resources, keeping DSOs in the signed frameworks directory
+            if (isApp && FunctionProjectSettings.instance.embedResources)
+                EmbedResources(
+                    cache,
+                    Path.Combine(outputPath, @"Contents", @"Resources", @"Data", @"StreamingAssets"),
+                    frameworkDir
+                );
             // Check Xcode project
-            if (isApp)
+            if (isApp) {
+                cache = null;
                 return;
+            }
         #if UNITY_STANDALONE_OSX
             // Load Xcode project
             var projectName = new DirectoryInfo(outputPath).Name + ".xcodeproj";
@@ -26,6 +26,7 @@ namespace Function.Editor {
 
         #region --Client API--
         public string accessKey;
+        public bool embedResources;
 
         public void Save () => Save(false);
         #endregion
@@ -7,6 +7,7 @@ namespace Function.Editor {
 
     using System.Collections.Generic;
     using UnityEditor;
+    using UnityEngine;
 
     internal static class FunctionSettingsProvider {
 
@@ -18,6 +19,12 @@ namespace Function.Editor {
                 EditorGUI.BeginChangeCheck();
                 EditorGUILayout.LabelField(@"Function Account", EditorStyles.boldLabel);
                 settings.accessKey = EditorGUILayout.TextField(@"Access Key", settings.accessKey);
+                EditorGUILayout.Space();
+                EditorGUILayout.LabelField(@"Build", EditorStyles.boldLabel);
+                settings.embedResources = EditorGUILayout.Toggle(
+                    new GUIContent(@"Embed Resources", @"Bundle embedded predictor resources into desktop and Linux builds so they run fully offline."),
+                    settings.embedResources
+                );
                 if (EditorGUI.EndChangeCheck())
                     settings.Save();
             },
@@ -7,11 +7,16 @@
 
 namespace Function.API {
 
+    using System;
     using System.Collections.Generic;
+    using System.Diagnostics;
     using System.IO;
+    using System.Linq;
+    using System.Net;
     using System.Net.Http;
     using System.Net.Http.Headers;
     using System.Text;
+    using System.Threading;
     using System.Threading.Tasks;
     using Newtonsoft.Json;
 
@@ -21,21 +26,40 @@ namespace Function.API {
     public sealed class DotNetClient : FunctionClient {
 
         #region --Client API--
+        /// <summary>
+        /// Invoked with request timings when a request completes.
+        /// </summary>
+        public event Action<RequestMetrics>? OnRequestCompleted;
+
         /// <summary>
         /// Create the .NET Function API client.
         /// </summary>
         /// <param name="url">Function API URL.</param>
         /// <param name="accessKey">Function access key.</param>
-        /// <param name="clientId">Client identifier.</param>
-        /// <param name="deviceId">Device model identifier.</param>
-        /// <param name="cachePath">Prediction resource cache path.</param>
+        /// <param name="transport">HTTP transport. When `null` a process-wide transport is shared across clients.</param>
         public DotNetClient (
             string url,
-            string? accessKey = default
-        ) : base(url.TrimEnd('/'), accessKey) {
-            client = new();
+            string? accessKey = default,
+            HttpClient? transport = default
+        ) : base(url.TrimEnd('/'), accessKey) => client = transport ?? SharedTransport.Value;
+
+        /// <summary>
+        /// Create an HTTP transport which can be shared across clients.
+        /// The transport pools and keeps connections alive, accepts compressed responses, and requests HTTP/2 where the platform supports it.
+        /// On .NET Core, pooled connections are recycled every few minutes so that DNS changes are picked up.
+        /// Mono does not support recycling pooled connections.
+        /// </summary>
+        /// <param name="maxConnectionsPerServer">Maximum number of concurrent connections per server.</param>
+        /// <param name="timeout">Request timeout. This includes reading the response body of REST requests, but not downloads or event streams.</param>
+        public static HttpClient CreateTransport (
+            int maxConnectionsPerServer = 32,
+            TimeSpan? timeout = default
+        ) {
+            var handler = CreateHandler(maxConnectionsPerServer);
+            var client = new HttpClient(handler) { Timeout = timeout ?? TimeSpan.FromSeconds(100) };
             var ua = new ProductInfoHeaderValue(@"FunctionDotNet", Function.Version);
             client.DefaultRequestHeaders.UserAgent.Add(ua);
+            return client;
         }
 
         /// <summary>
@@ -53,32 +77,57 @@ namespace Function.API {
             Dictionary<string, object?>? payload = default,
             Dictionary<string, string>? headers = default
         ) where T : class {
-            using var message = new HttpRequestMessage(new HttpMethod(method), $"{url}{path}");       
-            if (!string.IsNullOrEmpty(accessKey))
-                message.Headers.Authorization = new AuthenticationHeaderValue(@"Bearer", accessKey);
-            if (headers != null)
-                foreach (var header in headers)
-                    message.Headers.Add(header.Key, header.Value);
-            if (payload != null) {
-                var serializationSettings = new JsonSerializerSettings { NullValueHandling = NullValueHandling.Ignore };
-                var payloadStr = JsonConvert.SerializeObject(payload, serializationSettings);
-                message.Content = new StringContent(payloadStr, Encoding.UTF8, @"application/json");
-            }
-            using var response = await client.SendAsync(message);
-            var responseStr = await response.Content.ReadAsStringAsync();
-            if ((int)response.StatusCode >= 400) {
-                var errorPayload = JsonConvert.DeserializeObject<ErrorResponse>(responseStr);
-                var error = errorPayload?.errors?[0]?.message ?? @"An unknown error occurred";
-                throw new FunctionAPIException(error, (int)response.StatusCode);
+            using var message = CreateRequestMessage(method, path, payload, headers);
+            using var deadline = new CancellationTokenSource(client.Timeout); // `HttpClient` stops timing once headers are read
+            var watch = Stopwatch.StartNew();
+            try {
+                using var response = await client.SendAsync(message, HttpCompletionOption.ResponseHeadersRead, deadline.Token);
+                var ttfb = watch.Elapsed.TotalMilliseconds;
+                using var stream = await response.Content.ReadAsStreamAsync();
+                using var buffer = new MemoryStream();
+                await stream.CopyToAsync(buffer, 81920, deadline.Token);
+                Report(message, response, watch, ttfb, buffer.Length);
+                if (IsCompressed(message) && RejectCompression((int)response.StatusCode))
+                    return await Request<T>(method, path, payload, headers);
+                var responseStr = Encoding.UTF8.GetString(buffer.GetBuffer(), 0, (int)buffer.Length);
+                if ((int)response.StatusCode >= 400) {
+                    var errorPayload = JsonConvert.DeserializeObject<ErrorResponse>(responseStr);
+                    var error = errorPayload?.errors?[0]?.message ?? @"An unknown error occurred";
+                    throw new FunctionAPIException(error, (int)response.StatusCode);
+                }
+                return JsonConvert.DeserializeObject<T>(responseStr)!;
+            } catch (OperationCanceledException) when (deadline.IsCancellationRequested) {
+                throw new TimeoutException($"Request to {message.RequestUri} timed out after {client.Timeout.TotalMilliseconds}ms");
             }
-            return JsonConvert.DeserializeObject<T>(responseStr)!;
         }
 
         /// <summary>
         /// Download a file.
         /// </summary>
         /// <param name="url">Data URL.</param>
-        public override Task<Stream> Download (string url) => client.GetStreamAsync(url);
+        public override async Task<Stream> Download (string url) {
+            var message = new HttpRequestMessage(HttpMethod.Get, url) { Version = RequestVersion };
+            var watch = Stopwatch.StartNew();
+            HttpResponseMessage? response = null;
+            try {
+                response = await client.SendAsync(message, HttpCompletionOption.ResponseHeadersRead);
+                var ttfb = watch.Elapsed.TotalMilliseconds;
+                if (!response.IsSuccessStatusCode) {
+                    Report(message, response, watch, ttfb, 0);
+                    response.EnsureSuccessStatusCode();
+                }
+                var stream = await response.Content.ReadAsStreamAsync();
+                return new ResponseStream(stream, (received) => { // the response is released once the caller is done reading
+                    Report(message, response, watch, ttfb, received);
+                    response.Dispose();
+                    message.Dispose();
+                });
+            } catch {
+                response?.Dispose();
+                message.Dispose();
+                throw;
+            }
+        }
 
         /// <summary>
         /// Upload a data stream.
@@ -89,14 +138,188 @@ namespace Function.API {
         public override async Task Upload (Stream stream, string url, string? mime = null) {
             using var content = new StreamContent(stream);
             content.Headers.ContentType = new MediaTypeHeaderValue(mime ?? @"application/octet-stream");
-            using var response = await client.PutAsync(url, content);
+            using var message = new HttpRequestMessage(HttpMethod.Put, url) { Content = content, Version = RequestVersion };
+            var watch = Stopwatch.StartNew();
+            using var response = await client.SendAsync(message);
+            Report(message, response, watch, watch.Elapsed.TotalMilliseconds, response.Content.Headers.ContentLength ?? 0);
             response.EnsureSuccessStatusCode();
         }
+
+        /// <summary>
+        /// Make a request to a REST endpoint and consume the server-sent events in the response.
+        /// </summary>
+        /// <typeparam name="T">Deserialized event type.</typeparam>
+        /// <param name="method">HTTP request method.</param>
+        /// <param name="path">Endpoint path.</param>
+        /// <param name="payload">Request body.</param>
+        /// <param name="headers">Request headers.</param>
+        /// <returns>Deserialized events as they are received.</returns>
+        public override async IAsyncEnumerable<T> Stream<T> (
+            string method,
+            string path,
+            Dictionary<string, object?>? payload = default,
+            Dictionary<string, string>? headers = default
+        ) where T : class {
+            using var message = CreateRequestMessage(method, path, payload, headers);
+            message.Headers.Accept.Add(new MediaTypeWithQualityHeaderValue(@"text/event-stream"));
+            var watch = Stopwatch.StartNew();
+            using var response = await client.SendAsync(message, HttpCompletionOption.ResponseHeadersRead);
+            var ttfb = watch.Elapsed.TotalMilliseconds;
+            if (IsCompressed(message) && RejectCompression((int)response.StatusCode)) {
+                await foreach (var value in Stream<T>(method, path, payload, headers))
+                    yield return value;
+                yield break;
+            }
+            if ((int)response.StatusCode >= 400) {
+                var responseData = await response.Content.ReadAsByteArrayAsync();
+                Report(message, response, watch, ttfb, responseData.Length);
+                var responseStr = Encoding.UTF8.GetString(responseData);
+                var errorPayload = JsonConvert.DeserializeObject<ErrorResponse>(responseStr);
+                var error = errorPayload?.errors?[0]?.message ?? @"An unknown error occurred";
+                throw new FunctionAPIException(error, (int)response.StatusCode);
+            }
+            using var stream = new ResponseStream(await response.Content.ReadAsStreamAsync());
+            using var reader = new StreamReader(stream, Encoding.UTF8);
+            var parser = new EventStreamParser();
+            string? line;
+            while ((line = await reader.ReadLineAsync()) != null) {
+                var value = parser.Push<T>(line);
+                if (value != null)
+                    yield return value;
+            }
+            var last = parser.Flush<T>();
+            if (last != null)
+                yield return last;
+            Report(message, response, watch, ttfb, stream.Position);
+        }
         #endregion
 
 
         #region --Operations--
         private readonly HttpClient client;
+        private static readonly Lazy<HttpClient> SharedTransport = new(() => CreateTransport()); // lives for the process, see `CreateHandler`
+        private static readonly Type? SocketsHandlerType = Type.GetType(@"System.Net.Http.SocketsHttpHandler, System.Net.Http");
+        private static readonly Version RequestVersion = SocketsHandlerType != null ?
+            new(2, 0) : // HTTP/2 with fallback on .NET Core
+            new(1, 1);  // Mono rejects any other version
+        private static readonly TimeSpan ConnectionLifetime = TimeSpan.FromMinutes(5);
+
+        private static HttpMessageHandler CreateHandler (int maxConnectionsPerServer) {
+            var decompression = DecompressionMethods.GZip | DecompressionMethods.Deflate;
+            if (SocketsHandlerType != null) { // not in .NET Standard 2.1, so configure it by reflection
+                var handler = (HttpMessageHandler)Activator.CreateInstance(SocketsHandlerType);
+                SocketsHandlerType.GetProperty(@"PooledConnectionLifetime")!.SetValue(handler, ConnectionLifetime);
+                SocketsHandlerType.GetProperty(@"MaxConnectionsPerServer")!.SetValue(handler, maxConnectionsPerServer);
+                SocketsHandlerType.GetProperty(@"AutomaticDecompression")!.SetValue(handler, decompression);
+                return handler;
+            }
+            return new HttpClientHandler { // Mono keeps pooled connections until the server closes them
+                MaxConnectionsPerServer = maxConnectionsPerServer,
+                AutomaticDecompression = decompression,
+            };
+        }
+
+        private HttpRequestMessage CreateRequestMessage (
+            string method,
+            string path,
+            Dictionary<string, object?>? payload,
+            Dictionary<string, string>? headers
+        ) {
+            var message = new HttpRequestMessage(new HttpMethod(method), $"{url}{path}") { Version = RequestVersion };
+            if (!string.IsNullOrEmpty(accessKey))
+                message.Headers.Authorization = new AuthenticationHeaderValue(@"Bearer", accessKey);
+            if (headers != null)
+                foreach (var header in headers)
+                    message.Headers.Add(header.Key, header.Value);
+            if (payload != null) {
+                var content = new ByteArrayContent(SerializePayload(payload, out var encoding));
+                content.Headers.ContentType = new MediaTypeHeaderValue(@"application/json") { CharSet = @"utf-8" };
+                if (encoding != null)
+                    content.Headers.ContentEncoding.Add(encoding);
+                message.Content = content;
+            }
+            return message;
+        }
+
+        private sealed class ResponseStream : Stream { // counts the bytes read from a response body
+
+            public ResponseStream (Stream stream, Action<long>? onDispose = null) {
+                this.stream = stream;
+                this.onDispose = onDispose;
+            }
+
+            public override bool CanRead => true;
+
+            public override bool CanSeek => false;
+
+            public override bool CanWrite => false;
+
+            public override long Length => stream.Length;
+
+            public override long Position {
+                get => received;
+                set => throw new NotSupportedException();
+            }
+
+            public override int Read (byte[] buffer, int offset, int count) {
+                var read = stream.Read(buffer, offset, count);
+                received += read;
+                return read;
+            }
+
+            public override async Task<int> ReadAsync (byte[] buffer, int offset, int count, CancellationToken cancellationToken) {
+                var read = await stream.ReadAsync(buffer, offset, count, cancellationToken);
+                received += read;
+                return read;
+            }
+
+            public override long Seek (long offset, SeekOrigin origin) => throw new NotSupportedException();
+
+            public override void Flush () { }
+
+            public override void SetLength (long value) => throw new NotSupportedException();
+
+            public override void Write (byte[] buffer, int offset, int count) => throw new NotSupportedException();
+
+            protected override void Dispose (bool disposing) {
+                if (disposing && !disposed) {
+                    disposed = true;
+                    stream.Dispose();
+                    onDispose?.Invoke(received);
+                }
+                base.Dispose(disposing);
+            }
+
+            private readonly Stream stream;
+            private readonly Action<long>? onDispose;
+            private long received;
+            private bool disposed;
+        }
+
+        private static bool IsCompressed (HttpRequestMessage message) => message.Content?.Headers.ContentEncoding.Any() ?? false;
+
+        private void Report (
+            HttpRequestMessage message,
+            HttpResponseMessage response,
+            Stopwatch watch,
+            double timeToFirstByte,
+            long bytesReceived
+        ) {
+            if (OnRequestCompleted == null)
+                return;
+            var total = watch.Elapsed.TotalMilliseconds;
+            OnRequestCompleted(new RequestMetrics {
+                method = message.Method.Method,
+                url = message.RequestUri.ToString(),
+                status = (int)response.StatusCode,
+                version = response.Version,
+                bytesSent = message.Content?.Headers.ContentLength ?? 0,
+                bytesReceived = bytesReceived,
+                timeToFirstByte = timeToFirstByte,
+                transferTime = total - timeToFirstByte,
+                totalTime = total,
+            });
+        }
         #endregion
     }
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+/*
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.API {
+
+    using System.Text;
+    using Newtonsoft.Json;
+
+    /// <summary>
+    /// Incremental parser for `text/event-stream` responses.
+    /// </summary>
+    internal sealed class EventStreamParser {
+
+        #region --Client API--
+        /// <summary>
+        /// Push a line of the event stream, without its line terminator.
+        /// </summary>
+        /// <typeparam name="T">Deserialized event type.</typeparam>
+        /// <param name="line">Event stream line.</param>
+        /// <returns>Deserialized event if the line completes an event, `null` otherwise.</returns>
+        public T? Push<T> (string line) where T : class {
+            if (line.Length == 0)
+                return Dispatch<T>();
+            if (line[0] == ':')
+                return null;
+            var separator = line.IndexOf(':');
+            var field = separator < 0 ? line : line.Substring(0, separator);
+            var value = separator < 0 ? string.Empty : line.Substring(separator + 1);
+            if (value.Length > 0 && value[0] == ' ')
+                value = value.Substring(1);
+            switch (field) {
+                case @"event":
+                    eventName = value;
+                    break;
+                case @"data":
+                    if (data.Length > 0)
+                        data.Append('\n');
+                    data.Append(value);
+                    break;
+            }
+            return null;
+        }
+
+        /// <summary>
+        /// Flush any pending event at the end of the stream.
+        /// </summary>
+        /// <typeparam name="T">Deserialized event type.</typeparam>
+        /// <returns>Deserialized event if one is pending, `null` otherwise.</returns>
+        public T? Flush<T> () where T : class => Dispatch<T>();
+        #endregion
+
+
+        #region --Operations--
+        private readonly StringBuilder data = new();
+        private string? eventName;
+
+        private T? Dispatch<T> () where T : class {
+            if (data.Length == 0) {
+                eventName = null;
+                return null;
+            }
+            var name = eventName;
+            var payload = data.ToString();
+            eventName = null;
+            data.Clear();
+            if (name == @"error") {
+                var errorPayload = JsonConvert.DeserializeObject<ErrorResponse>(payload);
+                var error = errorPayload?.errors?[0]?.message ?? @"An unknown error occurred";
+                throw new FunctionAPIException(error, 500);
+            }
+            return JsonConvert.DeserializeObject<T>(payload);
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -8,9 +8,13 @@
 
 namespace Function.API {
 
+    using System;
     using System.Collections.Generic;
     using System.IO;
+    using System.IO.Compression;
+    using System.Text;
     using System.Threading.Tasks;
+    using Newtonsoft.Json;
 
     /// <summary>
     /// Function API client.
@@ -23,6 +27,12 @@ namespace Function.API {
         /// </summary>
         public readonly string url;
 
+        /// <summary>
+        /// Minimum request body size in bytes at which request bodies are gzip-compressed.
+        /// Compression is disabled when `null`, and is disabled automatically if the server rejects compressed requests.
+        /// </summary>
+        public int? compressionThreshold { get; set; }
+
         /// <summary>
         /// Make a request to a REST endpoint.
         /// </summary>
@@ -52,6 +62,22 @@ namespace Function.API {
         /// <param name="url">Upload URL.</param>
         /// <param name="mime">MIME type.</param>
         public abstract Task Upload (Stream stream, string url, string? mime = null);
+
+        /// <summary>
+        /// Make a request to a REST endpoint and consume the server-sent events in the response.
+        /// </summary>
+        /// <typeparam name="T">Deserialized event type.</typeparam>
+        /// <param name="method">HTTP request method.</param>
+        /// <param name="path">Endpoint path.</param>
+        /// <param name="payload">Request body.</param>
+        /// <param name="headers">Request headers.</param>
+        /// <returns>Deserialized events as they are received.</returns>
+        public virtual IAsyncEnumerable<T> Stream<T> (
+            string method,
+            string path,
+            Dictionary<string, object?>? payload = default,
+            Dictionary<string, string>? headers = default
+        ) where T : class => throw new NotSupportedException($"{GetType().Name} does not support streaming requests");
         #endregion
 
 
@@ -61,10 +87,45 @@ namespace Function.API {
         /// </summary>
         protected internal readonly string? accessKey;
     
+        private volatile bool compressionRejected;
+
         protected FunctionClient (string url, string? accessKey) {
             this.url = url;
             this.accessKey = accessKey;
         }
+
+        /// <summary>
+        /// Serialize a request payload, compressing it when it exceeds the compression threshold.
+        /// </summary>
+        /// <param name="payload">Request body.</param>
+        /// <param name="encoding">Content encoding of the serialized payload, or `null` if it is not compressed.</param>
+        /// <returns>Serialized payload.</returns>
+        protected byte[] SerializePayload (Dictionary<string, object?> payload, out string? encoding) {
+            var serializationSettings = new JsonSerializerSettings { NullValueHandling = NullValueHandling.Ignore };
+            var data = Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(payload, serializationSettings));
+            encoding = null;
+            if (compressionThreshold == null || compressionRejected || data.Length < compressionThreshold)
+                return data;
+            using var stream = new MemoryStream();
+            using (var gzip = new GZipStream(stream, CompressionLevel.Fastest, true))
+                gzip.Write(data, 0, data.Length);
+            if (stream.Length >= data.Length)
+                return data;
+            encoding = @"gzip";
+            return stream.ToArray();
+        }
+
+        /// <summary>
+        /// Stop compressing request bodies because the server does not accept them.
+        /// </summary>
+        /// <param name="status">Response status code.</param>
+        /// <returns>Whether the request should be retried without compression.</returns>
+        protected bool RejectCompression (int status) {
+            if (status != 415)
+                return false;
+            compressionRejected = true;
+            return true;
+        }
         #endregion
     }
 
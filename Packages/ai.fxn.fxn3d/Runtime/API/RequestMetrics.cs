@@ -0,0 +1,66 @@
+/*
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+#pragma warning disable 8618
+
+namespace Function.API {
+
+    using System;
+
+    /// <summary>
+    /// Timings for a completed API request.
+    /// NOTE: DNS and connection establishment are not observable through the managed HTTP stack,
+    /// so they are included in `timeToFirstByte`.
+    /// </summary>
+    public struct RequestMetrics {
+
+        /// <summary>
+        /// HTTP request method.
+        /// </summary>
+        public string method;
+
+        /// <summary>
+        /// Request URL.
+        /// </summary>
+        public string url;
+
+        /// <summary>
+        /// HTTP response status code.
+        /// </summary>
+        public int status;
+
+        /// <summary>
+        /// Negotiated HTTP protocol version.
+        /// </summary>
+        public Version version;
+
+        /// <summary>
+        /// Request body size in bytes.
+        /// </summary>
+        public long bytesSent;
+
+        /// <summary>
+        /// Response body size in bytes, as read by the client after decompression.
+        /// Downloads are reported when the returned stream is disposed.
+        /// </summary>
+        public long bytesReceived;
+
+        /// <summary>
+        /// Time from sending the request to receiving response headers, in milliseconds.
+        /// </summary>
+        public double timeToFirstByte;
+
+        /// <summary>
+        /// Time spent reading the response body, in milliseconds.
+        /// </summary>
+        public double transferTime;
+
+        /// <summary>
+        /// Total request time in milliseconds.
+        /// </summary>
+        public double totalTime;
+    }
+}
\ No newline at end of file
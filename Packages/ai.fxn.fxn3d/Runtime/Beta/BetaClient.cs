@@ -9,6 +9,7 @@ namespace Function.Beta {
 
     using API;
     using Services;
+    using LocalPredictionService = global::Function.Services.PredictionService;
 
     /// <summary>
     /// Client for incubating features.
@@ -25,8 +26,8 @@ namespace Function.Beta {
 
         #region --Operations--
 
-        internal BetaClient (FunctionClient client) {
-            this.Predictions = new PredictionService(client);
+        internal BetaClient (FunctionClient client, LocalPredictionService predictions) {
+            this.Predictions = new PredictionService(client, predictions);
         }
         #endregion
     }
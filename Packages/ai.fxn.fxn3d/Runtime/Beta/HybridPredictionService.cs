@@ -0,0 +1,177 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Beta.Services {
+
+    using System;
+    using System.Collections.Concurrent;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.Threading;
+    using System.Threading.Tasks;
+    using Types;
+    using PredictorLoadException = global::Function.Services.PredictorLoadException;
+    using LocalPredictionService = global::Function.Services.PredictionService;
+
+    /// <summary>
+    /// Make predictions on-device or remotely, whichever is expected to finish first.
+    /// Each prediction is routed using recent latencies and the number of in-flight predictions on each path.
+    /// A small fraction of predictions is sent down the slower path so that its latency estimate stays current.
+    /// </summary>
+    public sealed class HybridPredictionService {
+
+        #region --Client API--
+        /// <summary>
+        /// Invoked with the routing decision for every prediction.
+        /// </summary>
+        public event Action<HybridRoute>? OnRoute;
+
+        /// <summary>
+        /// Create a prediction on-device or remotely.
+        /// </summary>
+        /// <param name="tag">Predictor tag.</param>
+        /// <param name="inputs">Input values.</param>
+        /// <param name="acceleration">Prediction acceleration for on-device predictions.</param>
+        /// <param name="remoteAcceleration">Prediction acceleration for remote predictions.</param>
+        public async Task<Prediction> Create (
+            string tag,
+            Dictionary<string, object?> inputs,
+            Acceleration acceleration = default,
+            RemoteAcceleration remoteAcceleration = default
+        ) {
+            var state = states.GetOrAdd(tag, _ => new State());
+            var route = Route(tag, state);
+            OnRoute?.Invoke(route);
+            if (!route.remote)
+                try {
+                    return await Run(state.local, () => local.Create(tag, inputs, acceleration));
+                } catch (Exception ex) when (!state.local.loaded && !local.IsLoaded(tag)) { // predictor failed to load
+                    if (IsUnsupported(ex))
+                        state.localUnavailable = true;
+                    else
+                        state.BackOff();
+                    OnRoute?.Invoke(Route(tag, state));
+                }
+            return await Run(state.remote, () => remote.Create(tag, inputs, remoteAcceleration));
+        }
+
+        /// <summary>
+        /// Get routing statistics for a predictor.
+        /// </summary>
+        /// <param name="tag">Predictor tag.</param>
+        public HybridStatistics GetStatistics (string tag) {
+            var state = states.GetOrAdd(tag, _ => new State());
+            return new HybridStatistics {
+                tag = tag,
+                localLatency = state.local.latencies.Mean(),
+                localLatencyP95 = state.local.latencies.Percentile(0.95f),
+                localPending = state.local.pending,
+                localPredictions = state.local.count,
+                localLoaded = state.local.loaded,
+                localAvailable = !state.localUnavailable,
+                remoteLatency = state.remote.latencies.Mean(),
+                remoteLatencyP95 = state.remote.latencies.Percentile(0.95f),
+                remotePending = state.remote.pending,
+                remotePredictions = state.remote.count,
+            };
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly LocalPredictionService local;
+        private readonly RemotePredictionService remote;
+        private readonly ConcurrentDictionary<string, State> states = new();
+
+        internal HybridPredictionService (LocalPredictionService local, RemotePredictionService remote) {
+            this.local = local;
+            this.remote = remote;
+        }
+
+        internal static HybridRoute Route (string tag, State state) {
+            var localLatency = state.local.latencies.Mean();
+            var remoteLatency = state.remote.latencies.Mean();
+            var localEstimate = localLatency * (state.local.pending + 1); // on-device predictions run one at a time
+            var remoteEstimate = remoteLatency;
+            var (offload, reason) = state switch {
+                _ when state.localUnavailable           => (true, @"Predictor could not be loaded on-device"),
+                _ when state.backingOff                 => (true, @"Retrying on-device predictor load after a failure"),
+                _ when !state.local.loaded              => state.local.pending == 0 ?
+                    (false, @"Loading predictor on-device") :
+                    (true, @"Predictor is still loading on-device"),
+                _ when remoteEstimate == null           => state.local.pending > 0 ?
+                    (true, @"On-device predictor is busy and remote latency is unknown") :
+                    (false, @"Remote latency is unknown"),
+                _ when ThreadRandom.NextDouble() < ExplorationRate => remoteEstimate < localEstimate ?
+                    (state.local.pending > 0, @"Refreshing on-device latency estimate") : // never queue behind a busy predictor
+                    (true, @"Refreshing remote latency estimate"),
+                _                                       => remoteEstimate < localEstimate ?
+                    (true, @"Remote prediction is expected to finish first") :
+                    (false, @"On-device prediction is expected to finish first"),
+            };
+            return new HybridRoute {
+                tag = tag,
+                remote = offload,
+                reason = reason,
+                localEstimate = localEstimate,
+                remoteEstimate = remoteEstimate,
+            };
+        }
+
+        internal static bool IsUnsupported (Exception ex) => ex switch { // anything else is retried with backoff
+            PredictorLoadException _        => true, // the runtime rejected the predictor
+            DllNotFoundException _          => true, // the runtime itself is missing
+            EntryPointNotFoundException _   => true,
+            _                               => false,
+        };
+
+        internal static async Task<Prediction> Run (Path path, Func<Task<Prediction>> predict) {
+            Interlocked.Increment(ref path.pending);
+            var watch = Stopwatch.StartNew();
+            try {
+                var prediction = await predict();
+                if (path.loaded) // the first on-device prediction includes loading the predictor
+                    path.latencies.Add(watch.Elapsed.TotalMilliseconds);
+                path.loaded = true;
+                Interlocked.Increment(ref path.count);
+                return prediction;
+            } finally {
+                Interlocked.Decrement(ref path.pending);
+            }
+        }
+
+        private const double ExplorationRate = 0.05;
+        private static readonly TimeSpan InitialBackoff = TimeSpan.FromSeconds(1);
+        private static readonly TimeSpan MaxBackoff = TimeSpan.FromMinutes(1);
+
+        internal sealed class State {
+            public readonly Path local = new(loads: true);
+            public readonly Path remote = new(loads: false);
+            public volatile bool localUnavailable;
+            private int failures;
+            private long retryTimestamp;
+
+            public bool backingOff => Stopwatch.GetTimestamp() < Interlocked.Read(ref retryTimestamp);
+
+            public void BackOff () {
+                var retry = Math.Min(Interlocked.Increment(ref failures) - 1, 16);
+                var delay = Math.Min(InitialBackoff.TotalSeconds * (1L << retry), MaxBackoff.TotalSeconds);
+                Interlocked.Exchange(ref retryTimestamp, Stopwatch.GetTimestamp() + (long)(delay * Stopwatch.Frequency));
+            }
+        }
+
+        internal sealed class Path {
+            public readonly LatencyWindow latencies = new();
+            public int pending;
+            public int count;
+            public volatile bool loaded;
+
+            public Path (bool loads) => loaded = !loads; // remote predictions have no load phase
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+#pragma warning disable 8618
+
+namespace Function.Beta {
+
+    /// <summary>
+    /// Routing decision for a hybrid prediction.
+    /// </summary>
+    public struct HybridRoute {
+
+        /// <summary>
+        /// Predictor tag.
+        /// </summary>
+        public string tag;
+
+        /// <summary>
+        /// Whether the prediction is made remotely.
+        /// </summary>
+        public bool remote;
+
+        /// <summary>
+        /// Reason for the routing decision.
+        /// </summary>
+        public string reason;
+
+        /// <summary>
+        /// Expected on-device completion time in milliseconds.
+        /// This is `null` if there are not enough on-device predictions to estimate it.
+        /// </summary>
+        public double? localEstimate;
+
+        /// <summary>
+        /// Expected remote completion time in milliseconds.
+        /// This is `null` if there are not enough remote predictions to estimate it.
+        /// </summary>
+        public double? remoteEstimate;
+    }
+}
\ No newline at end of file
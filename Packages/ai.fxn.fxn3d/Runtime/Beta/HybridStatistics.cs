@@ -0,0 +1,72 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+#pragma warning disable 8618
+
+namespace Function.Beta {
+
+    /// <summary>
+    /// Routing statistics for hybrid predictions with a given predictor.
+    /// Latencies exclude the first prediction on each path, which includes loading the predictor.
+    /// </summary>
+    public struct HybridStatistics {
+
+        /// <summary>
+        /// Predictor tag.
+        /// </summary>
+        public string tag;
+
+        /// <summary>
+        /// Mean recent on-device latency in milliseconds.
+        /// </summary>
+        public double? localLatency;
+
+        /// <summary>
+        /// 95th percentile recent on-device latency in milliseconds.
+        /// </summary>
+        public double? localLatencyP95;
+
+        /// <summary>
+        /// Number of on-device predictions in flight.
+        /// </summary>
+        public int localPending;
+
+        /// <summary>
+        /// Number of completed on-device predictions.
+        /// </summary>
+        public int localPredictions;
+
+        /// <summary>
+        /// Whether the predictor has been loaded on-device.
+        /// </summary>
+        public bool localLoaded;
+
+        /// <summary>
+        /// Whether the predictor can run on-device.
+        /// </summary>
+        public bool localAvailable;
+
+        /// <summary>
+        /// Mean recent remote latency in milliseconds.
+        /// </summary>
+        public double? remoteLatency;
+
+        /// <summary>
+        /// 95th percentile recent remote latency in milliseconds.
+        /// </summary>
+        public double? remoteLatencyP95;
+
+        /// <summary>
+        /// Number of remote predictions in flight.
+        /// </summary>
+        public int remotePending;
+
+        /// <summary>
+        /// Number of completed remote predictions.
+        /// </summary>
+        public int remotePredictions;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Beta {
+
+    using System;
+
+    /// <summary>
+    /// Rolling window of recent latency samples.
+    /// </summary>
+    internal sealed class LatencyWindow {
+
+        #region --Client API--
+        /// <summary>
+        /// Number of samples in the window.
+        /// </summary>
+        public int Count {
+            get { lock (samples) return count; }
+        }
+
+        /// <summary>
+        /// Create a latency window.
+        /// </summary>
+        /// <param name="capacity">Maximum number of samples retained.</param>
+        public LatencyWindow (int capacity = 128) => this.samples = new double[capacity];
+
+        /// <summary>
+        /// Add a latency sample.
+        /// </summary>
+        /// <param name="latency">Latency in milliseconds.</param>
+        public void Add (double latency) {
+            lock (samples) {
+                samples[next] = latency;
+                next = (next + 1) % samples.Length;
+                count = Math.Min(count + 1, samples.Length);
+            }
+        }
+
+        /// <summary>
+        /// Get the mean latency of the window.
+        /// </summary>
+        /// <returns>Mean latency in milliseconds, or `null` if the window is empty.</returns>
+        public double? Mean () {
+            lock (samples) {
+                if (count == 0)
+                    return null;
+                var sum = 0.0;
+                for (var i = 0; i < count; ++i)
+                    sum += samples[i];
+                return sum / count;
+            }
+        }
+
+        /// <summary>
+        /// Get a latency percentile of the window.
+        /// </summary>
+        /// <param name="percentile">Percentile in range [0, 1].</param>
+        /// <returns>Latency in milliseconds, or `null` if the window is empty.</returns>
+        public double? Percentile (float percentile) {
+            double[] sorted;
+            lock (samples) {
+                if (count == 0)
+                    return null;
+                sorted = new double[count];
+                Array.Copy(samples, sorted, count);
+            }
+            Array.Sort(sorted);
+            var index = (int)Math.Ceiling(percentile * sorted.Length) - 1;
+            return sorted[Math.Max(Math.Min(index, sorted.Length - 1), 0)];
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly double[] samples;
+        private int next;
+        private int count;
+        #endregion
+    }
+}
\ No newline at end of file
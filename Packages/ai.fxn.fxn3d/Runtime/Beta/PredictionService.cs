@@ -8,6 +8,7 @@
 namespace Function.Beta.Services {
 
     using API;
+    using LocalPredictionService = global::Function.Services.PredictionService;
 
     /// <summary>
     /// Make predictions.
@@ -19,13 +20,19 @@ namespace Function.Beta.Services {
         /// Make remote predictions.
         /// </summary>
         public readonly RemotePredictionService Remote;
+
+        /// <summary>
+        /// Make predictions on-device or remotely, whichever is expected to finish first.
+        /// </summary>
+        public readonly HybridPredictionService Hybrid;
         #endregion
 
 
         #region --Operations--
 
-        internal PredictionService (FunctionClient client) {
+        internal PredictionService (FunctionClient client, LocalPredictionService local) {
             this.Remote = new RemotePredictionService(client);
+            this.Hybrid = new HybridPredictionService(local, Remote);
         }
         #endregion
     }
@@ -0,0 +1,48 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+#pragma warning disable 8618
+
+namespace Function.Beta {
+
+    /// <summary>
+    /// Timing for a single remote prediction request.
+    /// </summary>
+    public struct RemotePredictionAttempt {
+
+        /// <summary>
+        /// Predictor tag.
+        /// </summary>
+        public string tag;
+
+        /// <summary>
+        /// Idempotency key of the attempt.
+        /// Retries of a failed request share its key, while each hedged request has its own key.
+        /// </summary>
+        public string idempotencyKey;
+
+        /// <summary>
+        /// Retry index, starting at zero for the first attempt.
+        /// </summary>
+        public int retry;
+
+        /// <summary>
+        /// Whether this attempt is a duplicate request sent because the original was slow.
+        /// </summary>
+        public bool hedged;
+
+        /// <summary>
+        /// Attempt latency in milliseconds.
+        /// </summary>
+        public double latency;
+
+        /// <summary>
+        /// Attempt error.
+        /// This is `null` if the attempt succeeded.
+        /// </summary>
+        public string? error;
+    }
+}
\ No newline at end of file
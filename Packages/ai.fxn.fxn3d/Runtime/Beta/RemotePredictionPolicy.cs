@@ -0,0 +1,72 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Beta {
+
+    using System;
+
+    /// <summary>
+    /// Retry and hedging policy for remote predictions.
+    /// </summary>
+    public sealed class RemotePredictionPolicy {
+
+        #region --Client API--
+        /// <summary>
+        /// Maximum number of retries after a failed attempt.
+        /// Only network errors, timeouts, and `408`, `429`, and `5xx` responses are retried.
+        /// </summary>
+        public int maxRetries = 0;
+
+        /// <summary>
+        /// Delay before the first retry.
+        /// </summary>
+        public TimeSpan initialBackoff = TimeSpan.FromMilliseconds(250);
+
+        /// <summary>
+        /// Factor by which the retry delay grows after each retry.
+        /// </summary>
+        public float backoffMultiplier = 2f;
+
+        /// <summary>
+        /// Maximum delay between retries.
+        /// </summary>
+        public TimeSpan maxBackoff = TimeSpan.FromSeconds(8);
+
+        /// <summary>
+        /// Maximum time to wait for a single attempt.
+        /// When `null` an attempt waits for as long as the client allows.
+        /// </summary>
+        public TimeSpan? timeout;
+
+        /// <summary>
+        /// Whether to send a duplicate request when an attempt is slower than usual.
+        /// The first response to arrive is used. Each duplicate has its own idempotency key, so the server runs it independently of the original request.
+        /// </summary>
+        public bool hedge = false;
+
+        /// <summary>
+        /// Latency percentile of recent predictions with the same tag after which a duplicate request is sent.
+        /// </summary>
+        public float hedgePercentile = 0.95f;
+
+        /// <summary>
+        /// Minimum number of recent predictions with the same tag required before requests are hedged.
+        /// </summary>
+        public int hedgeMinSamples = 20;
+        #endregion
+
+
+        #region --Operations--
+
+        internal TimeSpan GetBackoff (int retry) {
+            var delay = initialBackoff.TotalMilliseconds * Math.Pow(backoffMultiplier, retry);
+            var jitter = 0.5 + 0.5 * ThreadRandom.NextDouble(); // avoid synchronized retries across clients
+            return TimeSpan.FromMilliseconds(Math.Min(delay, maxBackoff.TotalMilliseconds) * jitter);
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -8,10 +8,15 @@
 namespace Function.Beta.Services {
 
     using System;
+    using System.Buffers;
     using System.Collections;
+    using System.Collections.Concurrent;
     using System.Collections.Generic;
+    using System.Diagnostics;
     using System.IO;
-    using System.Linq;    
+    using System.Linq;
+    using System.Net.Http;
+    using System.Text;
     using System.Threading.Tasks;
     using Newtonsoft.Json;
     using Newtonsoft.Json.Linq;
@@ -25,6 +30,29 @@ namespace Function.Beta.Services {
     public sealed class RemotePredictionService {
 
         #region --Client API--
+        /// <summary>
+        /// Maximum size in bytes of input values that are inlined into the prediction request as base64 data URLs.
+        /// Larger values are uploaded to storage as raw bytes and passed to the prediction by URL.
+        /// Set this to zero to always upload raw bytes.
+        /// The prediction request itself is always JSON, since the API has no binary request body yet.
+        /// </summary>
+        public int maxDataUrlSize { get; set; } = 4 * 1024 * 1024;
+
+        /// <summary>
+        /// Retry and hedging policy for remote predictions.
+        /// </summary>
+        public RemotePredictionPolicy policy { get; set; } = new();
+
+        /// <summary>
+        /// Allocator used for downloaded prediction output buffers.
+        /// </summary>
+        public Allocator allocator { get; set; } = Allocator.Default;
+
+        /// <summary>
+        /// Invoked with request timings when a remote prediction attempt completes or fails.
+        /// </summary>
+        public event Action<RemotePredictionAttempt>? OnAttempt;
+
         /// <summary>
         /// Create a prediction by invoking it on a cloud instance.
         /// </summary>
@@ -38,11 +66,39 @@ namespace Function.Beta.Services {
             RemoteAcceleration acceleration = default
         ) {
             await Configuration.InitializationTask;
-            var inputMap = (await Task.WhenAll(inputs.Select(async pair => (
-                name: pair.Key,
-                value: await ToValue(pair.Value, pair.Key)
-            )))).ToDictionary(pair => pair.name, pair => pair.value);
-            var prediction = (await client.Request<RemotePrediction>(
+            var inputMap = await ToValueMap(inputs);
+            var payload = new Dictionary<string, object?> {
+                [@"tag"] = tag,
+                [@"inputs"] = inputMap,
+                [@"acceleration"] = acceleration,
+                [@"clientId"] = Configuration.ClientId,
+            };
+            var idempotencyKey = Guid.NewGuid().ToString("N");
+            var policy = this.policy;
+            for (var retry = 0; ; ++retry)
+                try {
+                    var prediction = await CreateRemotePrediction(tag, payload, idempotencyKey, retry, policy);
+                    return await ToPrediction(prediction);
+                } catch (Exception ex) when (retry < policy.maxRetries && IsTransient(ex)) {
+                    await Task.Delay(policy.GetBackoff(retry));
+                }
+        }
+
+        /// <summary>
+        /// Stream a prediction by invoking it on a cloud instance.
+        /// Partial predictions are decoded and returned as the server produces them.
+        /// </summary>
+        /// <param name="tag">Predictor tag.</param>
+        /// <param name="inputs">Input values.</param>
+        /// <param name="acceleration">Prediction acceleration.</param>
+        public async IAsyncEnumerable<Prediction> Stream (
+            string tag,
+            Dictionary<string, object?> inputs,
+            RemoteAcceleration acceleration = default
+        ) {
+            await Configuration.InitializationTask;
+            var inputMap = await ToValueMap(inputs);
+            var stream = client.Stream<RemotePrediction>(
                 method: @"POST",
                 path: $"/predictions/remote",
                 payload: new () {
@@ -50,17 +106,11 @@ namespace Function.Beta.Services {
                     [@"inputs"] = inputMap,
                     [@"acceleration"] = acceleration,
                     [@"clientId"] = Configuration.ClientId,
+                    [@"stream"] = true,
                 }
-            ))!;
-            return new Prediction {
-                id = prediction.id,
-                tag = prediction.tag,
-                created = prediction.created,
-                results = prediction.results != null ?await Task.WhenAll(prediction.results.Select(ToObject)) : null,
-                latency = prediction.latency,
-                error = prediction.error,
-                logs = prediction.logs,
-            };
+            );
+            await foreach (var prediction in stream)
+                yield return await ToPrediction(prediction);
         }
         #endregion
 
@@ -68,91 +118,244 @@ namespace Function.Beta.Services {
         #region --Operations--
         private readonly FunctionClient client;
 
+        private readonly ConcurrentDictionary<string, LatencyWindow> latencies = new();
+
         internal RemotePredictionService (FunctionClient client) => this.client = client;
 
+        private async Task<RemotePrediction> CreateRemotePrediction (
+            string tag,
+            Dictionary<string, object?> payload,
+            string idempotencyKey,
+            int retry,
+            RemotePredictionPolicy policy
+        ) {
+            var window = latencies.GetOrAdd(tag, _ => new LatencyWindow());
+            var attempts = new List<Task<RemotePrediction>> {
+                Attempt(tag, payload, idempotencyKey, retry, false, window, policy)
+            };
+            var hedgeDelay = policy.hedge && window.Count >= policy.hedgeMinSamples ? window.Percentile(policy.hedgePercentile) : null;
+            if (hedgeDelay != null) {
+                var first = await Task.WhenAny(attempts[0], Task.Delay(TimeSpan.FromMilliseconds(hedgeDelay.Value)));
+                if (first != attempts[0])
+                    attempts.Add(Attempt(tag, payload, Guid.NewGuid().ToString("N"), retry, true, window, policy)); // a shared key would let the server dedupe the hedge
+            }
+            while (true) {
+                var completed = await Task.WhenAny(attempts);
+                attempts.Remove(completed);
+                if (completed.Status != TaskStatus.RanToCompletion && attempts.Count > 0)
+                    continue;
+                foreach (var pending in attempts)
+                    _ = pending.ContinueWith(task => task.Exception, TaskContinuationOptions.OnlyOnFaulted); // observe losing attempt
+                return await completed;
+            }
+        }
+
+        private async Task<RemotePrediction> Attempt (
+            string tag,
+            Dictionary<string, object?> payload,
+            string idempotencyKey,
+            int retry,
+            bool hedged,
+            LatencyWindow window,
+            RemotePredictionPolicy policy
+        ) {
+            var watch = Stopwatch.StartNew();
+            var attempt = new RemotePredictionAttempt {
+                tag = tag,
+                idempotencyKey = idempotencyKey,
+                retry = retry,
+                hedged = hedged,
+            };
+            try {
+                var request = client.Request<RemotePrediction>(
+                    method: @"POST",
+                    path: $"/predictions/remote",
+                    payload: payload,
+                    headers: new () { [@"Idempotency-Key"] = idempotencyKey }
+                );
+                if (policy.timeout != null && await Task.WhenAny(request, Task.Delay(policy.timeout.Value)) != request) {
+                    _ = request.ContinueWith(task => task.Exception, TaskContinuationOptions.OnlyOnFaulted); // observe abandoned request
+                    throw new TimeoutException($"Remote prediction attempt timed out after {policy.timeout.Value.TotalMilliseconds}ms");
+                }
+                var prediction = (await request)!;
+                attempt.latency = watch.Elapsed.TotalMilliseconds;
+                window.Add(attempt.latency);
+                OnAttempt?.Invoke(attempt);
+                return prediction;
+            } catch (Exception ex) {
+                attempt.latency = watch.Elapsed.TotalMilliseconds;
+                attempt.error = ex.Message;
+                OnAttempt?.Invoke(attempt);
+                throw;
+            }
+        }
+
+        private static bool IsTransient (Exception ex) => ex switch {
+            FunctionAPIException e  => e.status == 0 || e.status == 408 || e.status == 429 || e.status >= 500,
+            TimeoutException _      => true,
+            HttpRequestException _  => true,
+            TaskCanceledException _ => true, // `HttpClient` timeout
+            _                       => false,
+        };
+
+        private async Task<Dictionary<string, Value>> ToValueMap (Dictionary<string, object?> inputs) => (await Task.WhenAll(
+            inputs.Select(async pair => (name: pair.Key, value: await ToValue(pair.Value, pair.Key)))
+        )).ToDictionary(pair => pair.name, pair => pair.value);
+
+        private async Task<Prediction> ToPrediction (RemotePrediction prediction) => new Prediction {
+            id = prediction.id,
+            tag = prediction.tag,
+            created = prediction.created,
+            results = prediction.results != null ? await Task.WhenAll(prediction.results.Select(ToObject)) : null,
+            latency = prediction.latency,
+            error = prediction.error,
+            logs = prediction.logs,
+        };
+
         private async Task<Value> ToValue ( // INCOMPLETE // Image
             object? value,
-            string name,
-            int maxDataUrlSize = 4 * 1024 * 1024
+            string name
         ) => value switch {
             null              => new Value { type = Dtype.Null },
-            float           x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Float32, shape = new int[0] },
-            double          x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Float64, shape = new int[0] },
-            sbyte           x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int8, shape = new int[0] },
-            short           x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int16, shape = new int[0] },
-            int             x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int32, shape = new int[0] },
-            long            x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int64, shape = new int[0] },
-            byte            x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint8, shape = new int[0] },
-            ushort          x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint16, shape = new int[0] },
-            uint            x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint32, shape = new int[0] },
-            ulong           x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint64, shape = new int[0] },
-            bool            x => new Value { data = await Upload(new [] { x }.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Bool, shape = new int[0] },
-            float[]         x => new Value { data = await Upload(x.ToStream(), name,  maxDataUrlSize: maxDataUrlSize), type = Dtype.Float32, shape = new [] { x.Length } },
-            double[]        x => new Value { data = await Upload(x.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Float64, shape = new [] { x.Length } },
-            sbyte[]         x => new Value { data = await Upload(x.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int8, shape = new [] { x.Length } },
-            short[]         x => new Value { data = await Upload(x.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int16, shape = new [] { x.Length } },
-            int[]           x => new Value { data = await Upload(x.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int32, shape = new [] { x.Length } },
-            long[]          x => new Value { data = await Upload(x.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int64, shape = new [] { x.Length } },
-            byte[]          x => new Value { data = await Upload(x.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint8, shape = new [] { x.Length } },
-            ushort[]        x => new Value { data = await Upload(x.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint16, shape = new [] { x.Length } },
-            uint[]          x => new Value { data = await Upload(x.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint32, shape = new [] { x.Length } },
-            ulong[]         x => new Value { data = await Upload(x.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint64, shape = new [] { x.Length } },
-            bool[]          x => new Value { data = await Upload(x.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Bool, shape = new [] { x.Length } },
-            Tensor<float>   x => new Value { data = await Upload(x.data.ToStream(),name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Float32, shape = x.shape },
-            Tensor<double>  x => new Value { data = await Upload(x.data.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Float64, shape = x.shape },
-            Tensor<sbyte>   x => new Value { data = await Upload(x.data.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int8, shape = x.shape },
-            Tensor<short>   x => new Value { data = await Upload(x.data.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int16, shape = x.shape },
-            Tensor<int>     x => new Value { data = await Upload(x.data.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int32, shape = x.shape },
-            Tensor<long>    x => new Value { data = await Upload(x.data.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Int64, shape = x.shape },
-            Tensor<byte>    x => new Value { data = await Upload(x.data.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint8, shape = x.shape },
-            Tensor<ushort>  x => new Value { data = await Upload(x.data.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint16, shape = x.shape },
-            Tensor<uint>    x => new Value { data = await Upload(x.data.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint32, shape = x.shape },
-            Tensor<ulong>   x => new Value { data = await Upload(x.data.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Uint64, shape = x.shape },
-            Tensor<bool>    x => new Value { data = await Upload(x.data.ToStream(), name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Bool, shape = x.shape },
-            string          x => new Value { data = await Upload(x.ToStream(), name, mime: @"text/plain", maxDataUrlSize: maxDataUrlSize), type = Dtype.String },
-            IList           x => new Value { data = await Upload(JsonConvert.SerializeObject(x).ToStream(), name, mime: @"application/json", maxDataUrlSize: maxDataUrlSize), type = Dtype.List },
-            IDictionary     x => new Value { data = await Upload(JsonConvert.SerializeObject(x).ToStream(), name, mime: @"application/json", maxDataUrlSize: maxDataUrlSize), type = Dtype.Dict },
+            Float16         x => await ToValue(new [] { x }, Dtype.Float16, new int[0], name),
+            BFloat16        x => await ToValue(new [] { x }, Dtype.BFloat16, new int[0], name),
+            float           x => await ToValue(new [] { x }, Dtype.Float32, new int[0], name),
+            double          x => await ToValue(new [] { x }, Dtype.Float64, new int[0], name),
+            sbyte           x => await ToValue(new [] { x }, Dtype.Int8, new int[0], name),
+            short           x => await ToValue(new [] { x }, Dtype.Int16, new int[0], name),
+            int             x => await ToValue(new [] { x }, Dtype.Int32, new int[0], name),
+            long            x => await ToValue(new [] { x }, Dtype.Int64, new int[0], name),
+            byte            x => await ToValue(new [] { x }, Dtype.Uint8, new int[0], name),
+            ushort          x => await ToValue(new [] { x }, Dtype.Uint16, new int[0], name),
+            uint            x => await ToValue(new [] { x }, Dtype.Uint32, new int[0], name),
+            ulong           x => await ToValue(new [] { x }, Dtype.Uint64, new int[0], name),
+            bool            x => await ToValue(new [] { x }, Dtype.Bool, new int[0], name),
+            Float16[]       x => await ToValue(x, Dtype.Float16, new [] { x.Length }, name),
+            BFloat16[]      x => await ToValue(x, Dtype.BFloat16, new [] { x.Length }, name),
+            float[]         x => await ToValue(x, Dtype.Float32, new [] { x.Length }, name),
+            double[]        x => await ToValue(x, Dtype.Float64, new [] { x.Length }, name),
+            sbyte[]         x => await ToValue(x, Dtype.Int8, new [] { x.Length }, name),
+            short[]         x => await ToValue(x, Dtype.Int16, new [] { x.Length }, name),
+            int[]           x => await ToValue(x, Dtype.Int32, new [] { x.Length }, name),
+            long[]          x => await ToValue(x, Dtype.Int64, new [] { x.Length }, name),
+            byte[]          x => await ToValue(x, Dtype.Uint8, new [] { x.Length }, name),
+            ushort[]        x => await ToValue(x, Dtype.Uint16, new [] { x.Length }, name),
+            uint[]          x => await ToValue(x, Dtype.Uint32, new [] { x.Length }, name),
+            ulong[]         x => await ToValue(x, Dtype.Uint64, new [] { x.Length }, name),
+            bool[]          x => await ToValue(x, Dtype.Bool, new [] { x.Length }, name),
+            Tensor<Float16> x => await ToValue(x, Dtype.Float16, name),
+            Tensor<BFloat16> x => await ToValue(x, Dtype.BFloat16, name),
+            Tensor<float>   x => await ToValue(x, Dtype.Float32, name),
+            Tensor<double>  x => await ToValue(x, Dtype.Float64, name),
+            Tensor<sbyte>   x => await ToValue(x, Dtype.Int8, name),
+            Tensor<short>   x => await ToValue(x, Dtype.Int16, name),
+            Tensor<int>     x => await ToValue(x, Dtype.Int32, name),
+            Tensor<long>    x => await ToValue(x, Dtype.Int64, name),
+            Tensor<byte>    x => await ToValue(x, Dtype.Uint8, name),
+            Tensor<ushort>  x => await ToValue(x, Dtype.Uint16, name),
+            Tensor<uint>    x => await ToValue(x, Dtype.Uint32, name),
+            Tensor<ulong>   x => await ToValue(x, Dtype.Uint64, name),
+            Tensor<bool>    x => await ToValue(x, Dtype.Bool, name),
+            string          x => new Value { data = await Upload(Encoding.UTF8.GetBytes(x), name, mime: @"text/plain"), type = Dtype.String },
+            IList           x => new Value { data = await Upload(Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(x)), name, mime: @"application/json"), type = Dtype.List },
+            IDictionary     x => new Value { data = await Upload(Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(x)), name, mime: @"application/json"), type = Dtype.Dict },
             Image           x => new Value { data = "", type = Dtype.Image },
-            Stream          x => new Value { data = await Upload(x, name, maxDataUrlSize: maxDataUrlSize), type = Dtype.Binary },
-            Enum            x => await ToValue(x.ToObject(), name, maxDataUrlSize: maxDataUrlSize),
+            Stream          x => new Value { data = await Upload(x, name), type = Dtype.Binary },
+            Enum            x => await ToValue(x.ToObject(), name),
             _                 => throw new InvalidOperationException($"Failed to serialize value '{value}' of type `{value.GetType()}` because it is not supported"),
         };
 
-        private async Task<object?> ToObject (Value value) { // INCOMPLETE // Image
-            if (value.type == Dtype.Null)
-                return null;
-            using var stream = await Download(value.data!);
-            return value.type switch {
-                Dtype.Float32   => stream.ToObject<float>(value.shape!),
-                Dtype.Float64   => stream.ToObject<double>(value.shape!),
-                Dtype.Int8      => stream.ToObject<sbyte>(value.shape!),
-                Dtype.Int16     => stream.ToObject<short>(value.shape!),
-                Dtype.Int32     => stream.ToObject<int>(value.shape!),
-                Dtype.Int64     => stream.ToObject<long>(value.shape!),
-                Dtype.Uint8     => stream.ToObject<byte>(value.shape!),
-                Dtype.Uint16    => stream.ToObject<ushort>(value.shape!),
-                Dtype.Uint32    => stream.ToObject<uint>(value.shape!),
-                Dtype.Uint64    => stream.ToObject<ulong>(value.shape!),
-                Dtype.Bool      => stream.ToObject<bool>(value.shape!),
-                Dtype.String    => new StreamReader(stream).ReadToEnd(),
-                Dtype.List      => JsonConvert.DeserializeObject<JArray>(new StreamReader(stream).ReadToEnd()),
-                Dtype.Dict      => JsonConvert.DeserializeObject<JObject>(new StreamReader(stream).ReadToEnd()),
-                Dtype.Image     => default,
-                Dtype.Binary    => stream.Clone(),
-                _               => throw new InvalidOperationException($"Failed to deserialize value with type {value.type} because it is not supported"),
-            };
+        private async Task<Value> ToValue<T> (
+            T[] data,
+            Dtype type,
+            int[] shape,
+            string name
+        ) where T : unmanaged => new Value {
+            data = await Upload(data, name),
+            type = type,
+            shape = shape
+        };
+
+        private async Task<Value> ToValue<T> (
+            Tensor<T> tensor,
+            Dtype type,
+            string name
+        ) where T : unmanaged => new Value {
+            data = await Upload(tensor, name),
+            type = type,
+            shape = tensor.shape
+        };
+
+        private async Task<object?> ToObject (Value value) => value.type switch { // INCOMPLETE // Image
+            Dtype.Null      => null,
+            Dtype.Float16   => (await DownloadArray<Float16>(value.data!)).ToObject(value.shape!),
+            Dtype.BFloat16  => (await DownloadArray<BFloat16>(value.data!)).ToObject(value.shape!),
+            Dtype.Float32   => (await DownloadArray<float>(value.data!)).ToObject(value.shape!),
+            Dtype.Float64   => (await DownloadArray<double>(value.data!)).ToObject(value.shape!),
+            Dtype.Int8      => (await DownloadArray<sbyte>(value.data!)).ToObject(value.shape!),
+            Dtype.Int16     => (await DownloadArray<short>(value.data!)).ToObject(value.shape!),
+            Dtype.Int32     => (await DownloadArray<int>(value.data!)).ToObject(value.shape!),
+            Dtype.Int64     => (await DownloadArray<long>(value.data!)).ToObject(value.shape!),
+            Dtype.Uint8     => (await DownloadArray<byte>(value.data!)).ToObject(value.shape!),
+            Dtype.Uint16    => (await DownloadArray<ushort>(value.data!)).ToObject(value.shape!),
+            Dtype.Uint32    => (await DownloadArray<uint>(value.data!)).ToObject(value.shape!),
+            Dtype.Uint64    => (await DownloadArray<ulong>(value.data!)).ToObject(value.shape!),
+            Dtype.Bool      => (await DownloadArray<bool>(value.data!)).ToObject(value.shape!),
+            Dtype.String    => Encoding.UTF8.GetString(await DownloadArray<byte>(value.data!)),
+            Dtype.List      => JsonConvert.DeserializeObject<JArray>(Encoding.UTF8.GetString(await DownloadArray<byte>(value.data!))),
+            Dtype.Dict      => JsonConvert.DeserializeObject<JObject>(Encoding.UTF8.GetString(await DownloadArray<byte>(value.data!))),
+            Dtype.Image     => default,
+            Dtype.Binary    => new MemoryStream(await DownloadArray<byte>(value.data!)),
+            _               => throw new InvalidOperationException($"Failed to deserialize value with type {value.type} because it is not supported"),
+        };
+
+        private async Task<string> Upload<T> (
+            T[] data,
+            string name,
+            string? mime = @"application/octet-stream"
+        ) where T : unmanaged {
+            if (data.SizeInBytes() <= maxDataUrlSize)
+                return data.ToDataUrl(mime);
+            var value = await client.Request<CreateValueResponse>(
+                method: @"POST",
+                path: "/values",
+                payload: new () { [@"name"] = name }
+            );
+            using var stream = data.ToStream();
+            await client.Upload(stream, value!.uploadUrl!, mime: mime);
+            return value.downloadUrl!;
+        }
+
+        private async Task<string> Upload<T> (Tensor<T> tensor, string name) where T : unmanaged {
+            using (var nativeStream = tensor.ToNativeStream())
+                if (nativeStream != null)
+                    return await Upload(nativeStream, name);
+            if (tensor.dense)
+                return await Upload(tensor.data, name);
+            var size = checked((int)tensor.SizeInBytes());
+            var buffer = ArrayPool<byte>.Shared.Rent(size); // views must be gathered, so use a pooled scratch buffer
+            try {
+                tensor.CopyTo(buffer);
+                using var stream = new MemoryStream(buffer, 0, size, false, true);
+                return await Upload(stream, name);
+            } finally {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
         }
 
         private async Task<string> Upload (
             Stream stream,
             string name,
-            string? mime = @"application/octet-stream",
-            int maxDataUrlSize = 4 * 1024 * 1024
+            string? mime = @"application/octet-stream"
         ) {
-            if (stream.Length <= maxDataUrlSize) {
-                var data = Convert.ToBase64String(stream.ToArray<byte>());
-                var result = $"data:{mime};base64,{data}";
-                return result;
+            if (stream.Length - stream.Position <= maxDataUrlSize) {
+                if (stream is MemoryStream memoryStream && memoryStream.TryGetBuffer(out var segment))
+                    return ValueUtils.ToDataUrl(segment.AsSpan((int)stream.Position), mime);
+                if (stream is UnmanagedMemoryStream unmanagedStream)
+                    return ValueUtils.ToDataUrl(unmanagedStream, mime);
+                using var buffer = new MemoryStream();
+                stream.CopyTo(buffer);
+                return buffer.GetBuffer().ToDataUrl(mime, (int)buffer.Length);
             }
             var value = await client.Request<CreateValueResponse>(
                 method: @"POST",
@@ -163,14 +366,16 @@ namespace Function.Beta.Services {
             return value.downloadUrl!;
         }
 
-        private async Task<Stream> Download (string url) {
-            if (url.StartsWith(@"data:")) {
-                var dataIdx = url.LastIndexOf(",") + 1;
-                var b64Data = url.Substring(dataIdx);
-                var data = Convert.FromBase64String(b64Data);
-                return new MemoryStream(data, 0, data.Length, false, false);
-            }
-            return await client.Download(url);
+        private async Task<T[]> DownloadArray<T> (string url) where T : unmanaged {
+            if (url.StartsWith(@"data:"))
+                return ValueUtils.FromDataUrl<T>(url, allocator);
+            using var stream = await client.Download(url);
+            if (stream.CanSeek)
+                return stream.ToArray<T>(allocator);
+            using var buffer = new MemoryStream();
+            stream.CopyTo(buffer);
+            buffer.Position = 0;
+            return buffer.ToArray<T>(allocator);
         }
 
         [Preserve, Serializable]
@@ -0,0 +1,37 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Beta {
+
+    using System;
+
+    /// <summary>
+    /// Per-thread random number generator.
+    /// </summary>
+    internal static class ThreadRandom {
+
+        #region --Client API--
+        /// <summary>
+        /// Get a random number in [0, 1) from the calling thread's generator.
+        /// </summary>
+        public static double NextDouble () => random.NextDouble();
+        #endregion
+
+
+        #region --Operations--
+        [ThreadStatic]
+        private static Random? threadRandom;
+        private static readonly Random seedRandom = new();
+        private static Random random => threadRandom ??= new Random(NextSeed());
+
+        private static int NextSeed () { // Mono seeds `Random` from the tick count, so threads started together would share a sequence
+            lock (seedRandom)
+                return seedRandom.Next();
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -11,6 +11,7 @@ namespace Function.Beta {
     using System.IO;
     using System.Linq;
     using System.Runtime.CompilerServices;
+    using System.Runtime.InteropServices;
     using System.Runtime.Serialization;
     using System.Text;
     using Types;
@@ -41,10 +42,9 @@ namespace Function.Beta {
     internal static class ValueUtils {
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static object ToObject<T> (this Stream stream, int[] shape) where T : unmanaged {
-            var data = stream.ToArray<T>();
-            return shape.Length > 0 ? new Tensor<T>(data, shape) : data[0];
-        }
+        public static object ToObject<T> (this T[] data, int[] shape) where T : unmanaged => shape.Length > 0 ?
+            new Tensor<T>(data, shape) :
+            data[0];
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         public static object ToObject (this Enum value) {
@@ -56,22 +56,56 @@ namespace Function.Beta {
         }
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static unsafe Stream ToStream<T> (this T[] data) where T : unmanaged {
-            if (data is byte[] raw)
-                return new MemoryStream(raw);
-            var size = data.Length * sizeof(T);
-            var array = new byte[size];
-            fixed (void* src = data, dst = array)
-                Buffer.MemoryCopy(src, dst, size, size);
-            return new MemoryStream(array);
+        public static Stream ToStream<T> (this T[] data) where T : unmanaged => data is byte[] raw ?
+            new MemoryStream(raw, false) :
+            new ArrayStream<T>(data);
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static unsafe long SizeInBytes<T> (this T[] data) where T : unmanaged => (long)data.Length * sizeof(T);
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static unsafe long SizeInBytes<T> (this Tensor<T> tensor) where T : unmanaged => tensor.shape.Aggregate(
+            (long)sizeof(T),
+            (a, b) => a * b
+        );
+
+        public static unsafe Stream? ToNativeStream<T> (this Tensor<T> tensor) where T : unmanaged => // borrows the caller's buffer
+            tensor.contiguous && tensor.nativeData != null ?
+                new UnmanagedMemoryStream((byte*)tensor.nativeData, tensor.SizeInBytes()) :
+                null;
+
+        public static unsafe void CopyTo<T> (this Tensor<T> tensor, byte[] buffer) where T : unmanaged {
+            fixed (byte* dst = buffer)
+                tensor.CopyTo((T*)dst);
         }
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static Stream ToStream (this string data) => new MemoryStream(Encoding.UTF8.GetBytes(data));
+        public static string ToDataUrl<T> (this T[] data, string? mime) where T : unmanaged => ToDataUrl(
+            MemoryMarshal.AsBytes(data.AsSpan()),
+            mime
+        );
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static unsafe T[] ToArray<T> (this Stream stream) where T : unmanaged {
-            var result = new T[stream.Length / sizeof(T)];
+        public static string ToDataUrl (this byte[] data, string? mime, int length) => ToDataUrl(
+            data.AsSpan(0, length),
+            mime
+        );
+
+        public static unsafe T[] FromDataUrl<T> (string url, Allocator allocator) where T : unmanaged {
+            var chars = url.AsSpan(url.IndexOf(',') + 1);
+            var padding = chars.Length > 0 && chars[chars.Length - 1] == '=' ?
+                (chars.Length > 1 && chars[chars.Length - 2] == '=' ? 2 : 1) :
+                0;
+            var size = chars.Length / 4 * 3 - padding;
+            var result = allocator.Allocate<T>(size / sizeof(T), AllocationCategory.Remote);
+            if (!Convert.TryFromBase64Chars(chars, MemoryMarshal.AsBytes(result.AsSpan()), out var written) || written != size)
+                throw new InvalidOperationException(@"Failed to decode value because data URL is malformed");
+            return result;
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static unsafe T[] ToArray<T> (this Stream stream, Allocator allocator) where T : unmanaged {
+            var result = allocator.Allocate<T>((int)(stream.Length / sizeof(T)), AllocationCategory.Remote);
             fixed (T* dst = result) 
                 using (var dstStream = new UnmanagedMemoryStream(
                     (byte*)dst,
@@ -83,11 +117,65 @@ namespace Function.Beta {
             return result;
         }
 
-        [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static Stream Clone (this Stream stream) {
-            var result = new MemoryStream();
-            stream.CopyTo(result);
-            return result;
+        public static unsafe string ToDataUrl (UnmanagedMemoryStream stream, string? mime) => ToDataUrl(
+            new ReadOnlySpan<byte>(stream.PositionPointer, (int)(stream.Length - stream.Position)),
+            mime
+        );
+
+        public static unsafe string ToDataUrl (ReadOnlySpan<byte> data, string? mime) { // encode straight into the string
+            var prefix = $"data:{mime};base64,";
+            fixed (byte* source = data)
+                return string.Create(
+                    prefix.Length + (data.Length + 2) / 3 * 4,
+                    (prefix, data: (IntPtr)source, length: data.Length),
+                    (chars, state) => {
+                        state.prefix.AsSpan().CopyTo(chars);
+                        var bytes = new ReadOnlySpan<byte>((void*)state.data, state.length);
+                        Convert.TryToBase64Chars(bytes, chars.Slice(state.prefix.Length), out _);
+                    }
+                );
         }
     }
+
+    /// <summary>
+    /// Read-only stream over the bytes of an array, without copying it.
+    /// </summary>
+    internal sealed class ArrayStream<T> : Stream where T : unmanaged {
+
+        public ArrayStream (T[] data) => this.data = data;
+
+        public override bool CanRead => true;
+
+        public override bool CanSeek => true;
+
+        public override bool CanWrite => false;
+
+        public override long Length => MemoryMarshal.AsBytes(data.AsSpan()).Length;
+
+        public override long Position { get; set; }
+
+        public override int Read (byte[] buffer, int offset, int count) => Read(buffer.AsSpan(offset, count));
+
+        public override int Read (Span<byte> buffer) {
+            var bytes = MemoryMarshal.AsBytes(data.AsSpan());
+            var count = (int)Math.Max(Math.Min(buffer.Length, bytes.Length - Position), 0);
+            bytes.Slice((int)Position, count).CopyTo(buffer);
+            Position += count;
+            return count;
+        }
+
+        public override long Seek (long offset, SeekOrigin origin) => Position = origin switch {
+            SeekOrigin.Begin    => offset,
+            SeekOrigin.Current  => Position + offset,
+            _                   => Length + offset,
+        };
+
+        public override void Flush () { }
+
+        public override void SetLength (long value) => throw new NotSupportedException();
+
+        public override void Write (byte[] buffer, int offset, int count) => throw new NotSupportedException();
+
+        private readonly T[] data;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,183 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.C {
+
+    using System;
+    using System.Numerics;
+    using System.Runtime.CompilerServices;
+    using BFloat16 = Types.BFloat16;
+    using Dtype = Types.Dtype;
+    using Float16 = Types.Float16;
+
+    internal static unsafe class Conversion {
+
+        #region --Client API--
+
+        /// <summary>
+        /// Whether conversion kernels use `System.Numerics.Vector` SIMD paths.
+        /// </summary>
+        internal static bool vectorized = Vector.IsHardwareAccelerated;
+
+        public static bool CanConvert (Dtype srcType, Dtype dstType) => (srcType, dstType) switch {
+            (Dtype.Float16, Dtype.Float32)  => true,
+            (Dtype.Float32, Dtype.Float16)  => true,
+            (Dtype.BFloat16, Dtype.Float32) => true,
+            (Dtype.Float32, Dtype.BFloat16) => true,
+            (Dtype.Float16, Dtype.BFloat16) => true,
+            (Dtype.BFloat16, Dtype.Float16) => true,
+            (Dtype.Int8, Dtype.Float32)     => true,
+            (Dtype.Float32, Dtype.Int8)     => true,
+            (Dtype.Float16, Dtype.Int8)     => true,
+            (Dtype.Int8, Dtype.Float16)     => true,
+            _                               => false,
+        };
+
+        public static void Convert (Dtype srcType, void* src, Dtype dstType, void* dst, long count) {
+            switch ((srcType, dstType)) {
+                case (Dtype.Float16, Dtype.Float32):    Float16ToFloat32((Float16*)src, (float*)dst, count); break;
+                case (Dtype.Float32, Dtype.Float16):    Float32ToFloat16((float*)src, (Float16*)dst, count); break;
+                case (Dtype.BFloat16, Dtype.Float32):   BFloat16ToFloat32((BFloat16*)src, (float*)dst, count); break;
+                case (Dtype.Float32, Dtype.BFloat16):   Float32ToBFloat16((float*)src, (BFloat16*)dst, count); break;
+                case (Dtype.Float16, Dtype.BFloat16):   Float16ToBFloat16((Float16*)src, (BFloat16*)dst, count); break;
+                case (Dtype.BFloat16, Dtype.Float16):   BFloat16ToFloat16((BFloat16*)src, (Float16*)dst, count); break;
+                case (Dtype.Int8, Dtype.Float32):       Int8ToFloat32((sbyte*)src, (float*)dst, count); break;
+                case (Dtype.Float32, Dtype.Int8):       Float32ToInt8((float*)src, (sbyte*)dst, count); break;
+                case (Dtype.Float16, Dtype.Int8):       Float16ToInt8((Float16*)src, (sbyte*)dst, count); break;
+                case (Dtype.Int8, Dtype.Float16):       Int8ToFloat16((sbyte*)src, (Float16*)dst, count); break;
+                default: throw new NotSupportedException($"Cannot convert value from {srcType} to {dstType}");
+            }
+        }
+
+        public static void Float16ToFloat32 (Float16* src, float* dst, long count) {
+            var i = 0L;
+            if (vectorized)
+                for (; i + Vector<ushort>.Count <= count; i += Vector<ushort>.Count) {
+                    Vector.Widen(*(Vector<ushort>*)(src + i), out var low, out var high);
+                    *(Vector<float>*)(dst + i) = Float16ToFloat32(low);
+                    *(Vector<float>*)(dst + i + Vector<uint>.Count) = Float16ToFloat32(high);
+                }
+            for (; i < count; ++i)
+                dst[i] = src[i];
+        }
+
+        public static void Float32ToFloat16 (float* src, Float16* dst, long count) {
+            for (var i = 0L; i < count; ++i)
+                dst[i] = (Float16)src[i];
+        }
+
+        public static void BFloat16ToFloat32 (BFloat16* src, float* dst, long count) {
+            var srcBits = (ushort*)src;
+            var dstBits = (uint*)dst;
+            var i = 0L;
+            if (vectorized)
+                for (; i + Vector<ushort>.Count <= count; i += Vector<ushort>.Count) {
+                    Vector.Widen(*(Vector<ushort>*)(srcBits + i), out var low, out var high);
+                    *(Vector<uint>*)(dstBits + i) = low * BFloat16Scale;
+                    *(Vector<uint>*)(dstBits + i + Vector<uint>.Count) = high * BFloat16Scale;
+                }
+            for (; i < count; ++i)
+                dstBits[i] = (uint)srcBits[i] << 16;
+        }
+
+        public static void Float32ToBFloat16 (float* src, BFloat16* dst, long count) {
+            for (var i = 0L; i < count; ++i)
+                dst[i] = (BFloat16)src[i];
+        }
+
+        public static void Int8ToFloat32 (sbyte* src, float* dst, long count) {
+            var i = 0L;
+            if (vectorized)
+                for (; i + Vector<sbyte>.Count <= count; i += Vector<sbyte>.Count) {
+                    Vector.Widen(*(Vector<sbyte>*)(src + i), out var low, out var high);
+                    Vector.Widen(low, out var a, out var b);
+                    Vector.Widen(high, out var c, out var d);
+                    var lanes = Vector<int>.Count;
+                    *(Vector<float>*)(dst + i) = Vector.ConvertToSingle(a);
+                    *(Vector<float>*)(dst + i + lanes) = Vector.ConvertToSingle(b);
+                    *(Vector<float>*)(dst + i + 2 * lanes) = Vector.ConvertToSingle(c);
+                    *(Vector<float>*)(dst + i + 3 * lanes) = Vector.ConvertToSingle(d);
+                }
+            for (; i < count; ++i)
+                dst[i] = src[i];
+        }
+
+        public static void Float32ToInt8 (float* src, sbyte* dst, long count) {
+            var i = 0L;
+            if (vectorized)
+                for (; i + Vector<sbyte>.Count <= count; i += Vector<sbyte>.Count) {
+                    var lanes = Vector<int>.Count;
+                    var low = Vector.Narrow(Float32ToInt32(src + i), Float32ToInt32(src + i + lanes));
+                    var high = Vector.Narrow(Float32ToInt32(src + i + 2 * lanes), Float32ToInt32(src + i + 3 * lanes));
+                    *(Vector<sbyte>*)(dst + i) = Vector.Narrow(low, high);
+                }
+            for (; i < count; ++i)
+                dst[i] = Float32ToInt8(src[i]);
+        }
+        #endregion
+
+
+        #region --Operations--
+
+        private static void Float16ToBFloat16 (Float16* src, BFloat16* dst, long count) {
+            for (var i = 0L; i < count; ++i)
+                dst[i] = (BFloat16)(float)src[i];
+        }
+
+        private static void BFloat16ToFloat16 (BFloat16* src, Float16* dst, long count) {
+            for (var i = 0L; i < count; ++i)
+                dst[i] = (Float16)(float)src[i];
+        }
+
+        private static void Float16ToInt8 (Float16* src, sbyte* dst, long count) {
+            for (var i = 0L; i < count; ++i)
+                dst[i] = Float32ToInt8(src[i]);
+        }
+
+        private static void Int8ToFloat16 (sbyte* src, Float16* dst, long count) {
+            for (var i = 0L; i < count; ++i)
+                dst[i] = (Float16)(float)src[i];
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static sbyte Float32ToInt8 (float value) => float.IsNaN(value) ?
+            (sbyte)0 :
+            (sbyte)MathF.Round(Math.Clamp(value, sbyte.MinValue, sbyte.MaxValue), MidpointRounding.ToEven);
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static Vector<float> Float16ToFloat32 (Vector<uint> half) { // same bit manipulation as `Float16`, without shifts
+            var bits = (half & new Vector<uint>(0x7FFF)) * new Vector<uint>(1 << 13);
+            var exponent = bits & new Vector<uint>(0x0F800000);
+            bits += new Vector<uint>((127 - 15) << 23);
+            bits += Vector.ConditionalSelect(
+                Vector.Equals(exponent, new Vector<uint>(0x0F800000)),
+                new Vector<uint>((128 - 16) << 23),
+                Vector<uint>.Zero
+            );
+            var denormal = Vector.AsVectorUInt32(
+                Vector.AsVectorSingle(bits + new Vector<uint>(1 << 23)) - new Vector<float>(Float16DenormalBias)
+            );
+            bits = Vector.ConditionalSelect(Vector.Equals(exponent, Vector<uint>.Zero), denormal, bits);
+            bits |= (half & new Vector<uint>(0x8000)) * new Vector<uint>(1 << 16);
+            return Vector.AsVectorSingle(bits);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static Vector<int> Float32ToInt32 (float* src) { // clamp, then round to nearest even with the 1.5 * 2^23 trick
+            var value = *(Vector<float>*)src;
+            value = Vector.ConditionalSelect(Vector.Equals(value, value), value, Vector<float>.Zero);
+            value = Vector.Min(Vector.Max(value, new Vector<float>(sbyte.MinValue)), new Vector<float>(sbyte.MaxValue));
+            value = (value + new Vector<float>(RoundingMagic)) - new Vector<float>(RoundingMagic);
+            return Vector.ConvertToInt32(value);
+        }
+
+        private const float Float16DenormalBias = 1f / 16384; // 2^-14
+        private const float RoundingMagic = 12582912f; // 1.5 * 2^23
+        private static readonly Vector<uint> BFloat16Scale = new(1 << 16);
+        #endregion
+    }
+}
\ No newline at end of file
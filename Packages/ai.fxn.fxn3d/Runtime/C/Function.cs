@@ -98,7 +98,7 @@ namespace Function.C {
         );
         [DllImport(Assembly, EntryPoint = @"FXNValueCreateBinary")]
         public static extern Status CreateBinaryValue (
-            [In] byte[] buffer,
+            byte* buffer,
             int bufferLen,
             Value.Flags flags,
             out IntPtr value
@@ -17,7 +17,7 @@ namespace Function.C {
 
         public string id {
             get {
-                var id = new StringBuilder(64);
+                var id = GetBuffer(64);
                 prediction.GetPredictionID(id, id.Capacity).Throw();
                 return id.ToString();
             }
@@ -41,14 +41,18 @@ namespace Function.C {
 
         public string? error {
             get {
-                var error = new StringBuilder(2048);
-                return prediction.GetPredictionError(error, error.Capacity) == Status.Ok ? error.ToString() : null;
+                var error = GetBuffer(2048);
+                return prediction.GetPredictionError(error, error.Capacity) == Status.Ok && error.Length > 0 ?
+                    error.ToString() :
+                    null;
             }
         }
 
         public string logs {
             get {
                 prediction.GetPredictionLogLength(out var length).Throw();
+                if (length == 0)
+                    return string.Empty;
                 var logs = new StringBuilder(length + 1);
                 prediction.GetPredictionLogs(logs, logs.Capacity);
                 return logs.ToString();
@@ -61,9 +65,18 @@ namespace Function.C {
 
         #region --Operations--
         private readonly IntPtr prediction;
+        [ThreadStatic]
+        private static StringBuilder? buffer;
 
         internal Prediction (IntPtr prediction) => this.prediction = prediction;
 
+        private static StringBuilder GetBuffer (int capacity) { // reused across calls on the same thread
+            buffer ??= new StringBuilder(capacity);
+            buffer.Clear();
+            buffer.EnsureCapacity(capacity);
+            return buffer;
+        }
+
         public static implicit operator IntPtr (Prediction prediction) => prediction.prediction;
         #endregion
     }
@@ -10,8 +10,11 @@ namespace Function.C {
     using System;
     using System.Collections;
     using System.IO;
+    using System.IO.MemoryMappedFiles;
     using System.Linq;
     using System.Runtime.InteropServices;
+    using System.Text;
+    using System.Text.RegularExpressions;
     using Newtonsoft.Json;
     using Newtonsoft.Json.Linq;
     using Types;
@@ -53,28 +56,40 @@ namespace Function.C {
             }
         }
 
-        public object? ToObject () => type switch {
-            Dtype.Null      => null,
-            Dtype.Float32   => ToObject((float*)data, shape),
-            Dtype.Float64   => ToObject((double*)data, shape),
-            Dtype.Int8      => ToObject((sbyte*)data, shape),
-            Dtype.Int16     => ToObject((short*)data, shape),
-            Dtype.Int32     => ToObject((int*)data, shape),
-            Dtype.Int64     => ToObject((long*)data, shape),
-            Dtype.Uint8     => ToObject((byte*)data, shape),
-            Dtype.Uint16    => ToObject((ushort*)data, shape),
-            Dtype.Uint32    => ToObject((uint*)data, shape),
-            Dtype.Uint64    => ToObject((ulong*)data, shape),
-            Dtype.Bool      => ToObject((bool*)data, shape),
-            Dtype.String    => Marshal.PtrToStringUTF8((IntPtr)data),
-            Dtype.List      => JsonConvert.DeserializeObject<JArray>(Marshal.PtrToStringUTF8((IntPtr)data)),
-            Dtype.Dict      => JsonConvert.DeserializeObject<JObject>(Marshal.PtrToStringUTF8((IntPtr)data)),
-            Dtype.Image     => new Image(ToArray((byte*)data, shape), shape[1], shape[0], shape[2]),
-            Dtype.Binary    => new MemoryStream(ToArray((byte*)data, shape)),
-            _               => throw new InvalidOperationException($"Cannot convert Function value to object because value type is unsupported: {type}"),
-        };
+        public object? ToObject (Allocator? allocator = null) {
+            var type = this.type; // query each property once to minimize native calls
+            if (type == Dtype.Null)
+                return null;
+            var data = this.data;
+            var shape = type switch {
+                Dtype.String or Dtype.List or Dtype.Dict    => null,
+                _                                           => this.shape,
+            };
+            return ToObject(type, data, shape!, allocator);
+        }
+
+        public Value Convert (Dtype dtype) {
+            var type = this.type;
+            if (!Conversion.CanConvert(type, dtype))
+                throw new NotSupportedException($"Cannot convert value from {type} to {dtype}");
+            var shape = this.shape;
+            var count = shape.Aggregate(1L, (a, b) => a * b);
+            CreateArrayValue(null, shape, shape.Length, dtype, Flags.None, out var value).Throw();
+            var result = new Value(value);
+            try {
+                Conversion.Convert(type, data, dtype, result.data, count);
+            } catch {
+                result.Dispose();
+                throw;
+            }
+            return result;
+        }
 
-        public void Dispose () => value.ReleaseValue();
+        public void Dispose () {
+            value.ReleaseValue();
+            deallocator?.Invoke();
+            deallocator = null;
+        }
 
         public static Value CreateArray<T> (T scalar) where T : unmanaged => CreateArray(
             new Tensor<T>(new [] { scalar }, new int[0]),
@@ -91,6 +106,17 @@ namespace Function.C {
             Flags flags = Flags.None
         ) where T : unmanaged {
             IntPtr value = default;
+            if (!tensor.contiguous) { // gather straight into runtime-allocated memory
+                CreateArrayValue(null, tensor.shape, tensor.shape.Length, ToDtype<T>(), Flags.None, out value).Throw();
+                var array = new Value(value);
+                try {
+                    tensor.CopyTo((T*)array.data);
+                } catch {
+                    array.Dispose();
+                    throw;
+                }
+                return array;
+            }
             fixed (T* data = tensor)
                 CreateArrayValue(
                     data,
@@ -103,6 +129,66 @@ namespace Function.C {
             return new Value(value);
         }
 
+        public static Value CreateArray<T> (
+            in Tensor<T> tensor,
+            Action deallocator
+        ) where T : unmanaged {
+            if (!tensor.contiguous) {
+                var array = CreateArray(tensor, Flags.None);
+                deallocator(); // strided tensors are gathered into runtime memory
+                return array;
+            }
+            if (tensor.data == null) {
+                var array = CreateArray(tensor, Flags.None);
+                array.deallocator = deallocator;
+                return array;
+            }
+            var handle = GCHandle.Alloc(tensor.data, GCHandleType.Pinned); // keep the GC from moving the borrowed array
+            try {
+                CreateArrayValue(
+                    (T*)handle.AddrOfPinnedObject() + tensor.offset,
+                    tensor.shape,
+                    tensor.shape.Length,
+                    ToDtype<T>(),
+                    Flags.None,
+                    out var value
+                ).Throw();
+                return new Value(value) {
+                    deallocator = () => {
+                        handle.Free();
+                        deallocator();
+                    }
+                };
+            } catch {
+                handle.Free();
+                throw;
+            }
+        }
+
+        public static Value CreateArray (
+            in Tensor<float> tensor,
+            Dtype dtype
+        ) {
+            if (!Conversion.CanConvert(Dtype.Float32, dtype))
+                throw new NotSupportedException($"Cannot create array value converted from {Dtype.Float32} to {dtype}");
+            CreateArrayValue(null, tensor.shape, tensor.shape.Length, dtype, Flags.None, out var value).Throw();
+            var array = new Value(value);
+            try { // convert straight into runtime-allocated memory
+                var count = tensor.shape.Aggregate(1L, (a, b) => a * b);
+                var dst = (byte*)array.data;
+                if (tensor.contiguous)
+                    fixed (float* data = tensor)
+                        Conversion.Convert(Dtype.Float32, data, dtype, dst, count);
+                else if (count > 0)
+                    fixed (float* data = tensor)
+                        ConvertStrided(data, tensor.shape, tensor.strides!, 0, dtype, ref dst);
+            } catch {
+                array.Dispose();
+                throw;
+            }
+            return array;
+        }
+
         public static Value CreateString (string input) {
             CreateStringValue(input, out var value).Throw();
             return new Value(value);
@@ -122,6 +208,25 @@ namespace Function.C {
 
         public static Value CreateImage (in Image image) {
             IntPtr value = default;
+            if (!image.packed) { // convert straight into memory the runtime borrows
+                var size = (long)image.width * image.height * image.channels;
+                var buffer = Marshal.AllocHGlobal((IntPtr)Math.Max(size, 1));
+                try {
+                    image.CopyTo((byte*)buffer);
+                    CreateImageValue(
+                        (byte*)buffer,
+                        image.width,
+                        image.height,
+                        image.channels,
+                        Flags.None,
+                        out value
+                    ).Throw();
+                } catch {
+                    Marshal.FreeHGlobal(buffer);
+                    throw;
+                }
+                return new Value(value) { deallocator = () => Marshal.FreeHGlobal(buffer) };
+            }
             fixed (byte* data = image)
                 CreateImageValue(
                     data,
@@ -134,17 +239,105 @@ namespace Function.C {
             return new Value(value);
         }
 
+        public static Value CreateImage (in Image image, Action deallocator) {
+            var value = CreateImage(image);
+            if (image.data == null && image.packed)
+                value.deallocator = deallocator;
+            else
+                deallocator(); // managed and converted pixel buffers are copied
+            return value;
+        }
+
         public static Value CreateBinary (Stream stream) {
-            byte[] data;
-            if (stream is MemoryStream memoryStream)
-                data = memoryStream.ToArray();
-            else {
+            if (stream is MemoryStream memoryStream && memoryStream.TryGetBuffer(out var segment)) {
+                var position = (int)Math.Min(memoryStream.Position, memoryStream.Length);
+                var count = (int)memoryStream.Length - position;
+                var value = CreateBinary(segment.AsSpan(position, count), Flags.CopyData);
+                memoryStream.Position = memoryStream.Length; // consume the stream like the copying paths below
+                return value;
+            }
+            if (!stream.CanSeek) {
                 using var dstStream = new MemoryStream();
                 stream.CopyTo(dstStream);
-                data = dstStream.ToArray();
+                return CreateBinary(dstStream);
             }
-            CreateBinaryValue(data, data.Length, Flags.CopyData, out var value).Throw();
-            return new Value(value);
+            var length = CheckBinaryLength(stream.Length - stream.Position);
+            var buffer = Marshal.AllocHGlobal(Math.Max(length, 1)); // read straight into memory the runtime borrows
+            try {
+                using (var dstStream = new UnmanagedMemoryStream((byte*)buffer, 0, length, FileAccess.Write)) {
+                    stream.CopyTo(dstStream);
+                    if (dstStream.Position != length)
+                        throw new EndOfStreamException(@"Cannot create binary value because stream ended before its reported length");
+                }
+                var value = CreateBinary((byte*)buffer, length, Flags.None);
+                value.deallocator = () => Marshal.FreeHGlobal(buffer);
+                return value;
+            } catch {
+                Marshal.FreeHGlobal(buffer);
+                throw;
+            }
+        }
+
+        public static Value CreateBinary (string path, long offset = 0, long length = -1) {
+            var fileLength = new FileInfo(path).Length;
+            length = length < 0 ? fileLength - offset : length;
+            if (length == 0 && offset >= 0 && offset <= fileLength)
+                return CreateBinary(Stream.Null);
+            var size = CheckBinaryLength(length);
+            return CreateMapped(path, offset, length, data => CreateBinary((byte*)data, size, Flags.None));
+        }
+
+        public static Value CreateArray<T> (
+            string path,
+            long offset,
+            int[] shape
+        ) where T : unmanaged => CreateArray(path, offset, shape, ToDtype<T>());
+
+        public static Value CreateArray (string path, long offset, int[] shape, Dtype dtype) {
+            var length = shape.Aggregate(1L, (a, b) => a * b) * GetElementSize(dtype);
+            if (length == 0)
+                throw new ArgumentException(@"Cannot create array value from file because shape has zero elements", nameof(shape));
+            return CreateMapped(path, offset, length, data => {
+                CreateArrayValue((void*)data, shape, shape.Length, dtype, Flags.None, out var value).Throw();
+                return new Value(value);
+            });
+        }
+
+        public static Value CreateArrayFromNpy (string path) {
+            using var stream = File.OpenRead(path);
+            using var reader = new BinaryReader(stream, Encoding.ASCII);
+            var magic = reader.ReadBytes(6);
+            if (magic.Length != 6 || magic[0] != 0x93 || Encoding.ASCII.GetString(magic, 1, 5) != @"NUMPY")
+                throw new InvalidDataException($"Cannot create array value because '{path}' is not an npy file");
+            var major = reader.ReadByte();
+            reader.ReadByte();
+            var headerLength = major == 1 ? reader.ReadUInt16() : (int)reader.ReadUInt32();
+            var header = Encoding.ASCII.GetString(reader.ReadBytes(headerLength));
+            var descr = Regex.Match(header, @"'descr'\s*:\s*'([^']+)'").Groups[1].Value;
+            var fortranOrder = Regex.Match(header, @"'fortran_order'\s*:\s*(True|False)").Groups[1].Value;
+            var shapeMatch = Regex.Match(header, @"'shape'\s*:\s*\(([^)]*)\)");
+            if (fortranOrder != @"False" || !shapeMatch.Success)
+                throw new InvalidDataException($"Cannot create array value because npy file '{path}' is not a C-contiguous array");
+            var shape = shapeMatch.Groups[1].Value
+                .Split(new [] { ',' }, StringSplitOptions.RemoveEmptyEntries)
+                .Select(dim => int.Parse(dim.Trim()))
+                .ToArray();
+            var dtype = descr switch {
+                @"<f2"              => Dtype.Float16,
+                @"<f4"              => Dtype.Float32,
+                @"<f8"              => Dtype.Float64,
+                @"|i1"              => Dtype.Int8,
+                @"<i2"              => Dtype.Int16,
+                @"<i4"              => Dtype.Int32,
+                @"<i8"              => Dtype.Int64,
+                @"|u1"              => Dtype.Uint8,
+                @"<u2"              => Dtype.Uint16,
+                @"<u4"              => Dtype.Uint32,
+                @"<u8"              => Dtype.Uint64,
+                @"|b1"              => Dtype.Bool,
+                _                   => throw new InvalidDataException($"Cannot create array value because npy file '{path}' has unsupported data type: {descr}"),
+            };
+            return CreateArray(path, stream.Position, shape, dtype);
         }
 
         public static Value CreateNull () {
@@ -156,39 +349,156 @@ namespace Function.C {
 
         #region --Operations--
         private readonly IntPtr value;
+        internal Action? deallocator; // invoked once the runtime no longer references the data
 
         internal Value (IntPtr value) => this.value = value;
 
         public static implicit operator IntPtr (Value value) => value.value;
 
-        private static unsafe object ToObject<T> (T* data, int[] shape) where T : unmanaged {
+        private static object? ToObject (Dtype type, void* data, int[] shape, Allocator? allocator) => type switch {
+            Dtype.Float16   => ToObject((Float16*)data, shape, allocator),
+            Dtype.BFloat16  => ToObject((BFloat16*)data, shape, allocator),
+            Dtype.Float32   => ToObject((float*)data, shape, allocator),
+            Dtype.Float64   => ToObject((double*)data, shape, allocator),
+            Dtype.Int8      => ToObject((sbyte*)data, shape, allocator),
+            Dtype.Int16     => ToObject((short*)data, shape, allocator),
+            Dtype.Int32     => ToObject((int*)data, shape, allocator),
+            Dtype.Int64     => ToObject((long*)data, shape, allocator),
+            Dtype.Uint8     => ToObject((byte*)data, shape, allocator),
+            Dtype.Uint16    => ToObject((ushort*)data, shape, allocator),
+            Dtype.Uint32    => ToObject((uint*)data, shape, allocator),
+            Dtype.Uint64    => ToObject((ulong*)data, shape, allocator),
+            Dtype.Bool      => ToObject((bool*)data, shape, allocator),
+            Dtype.String    => Marshal.PtrToStringUTF8((IntPtr)data),
+            Dtype.List      => JsonConvert.DeserializeObject<JArray>(Marshal.PtrToStringUTF8((IntPtr)data)),
+            Dtype.Dict      => JsonConvert.DeserializeObject<JObject>(Marshal.PtrToStringUTF8((IntPtr)data)),
+            Dtype.Image     => new Image(ToArray((byte*)data, shape, allocator), shape[1], shape[0], shape[2]),
+            Dtype.Binary    => new MemoryStream(ToArray((byte*)data, shape, allocator)),
+            _               => throw new InvalidOperationException($"Cannot convert Function value to object because value type is unsupported: {type}"),
+        };
+
+        private static unsafe object ToObject<T> (T* data, int[] shape, Allocator? allocator) where T : unmanaged {
             if (shape.Length == 0)
                 return *(T*)data;
-            var array = ToArray(data, shape);
+            var array = ToArray(data, shape, allocator);
             return new Tensor<T>(array, shape);
         }
 
-        private static unsafe T[] ToArray<T> (T* data, int[] shape) where T : unmanaged {
+        private static unsafe T[] ToArray<T> (T* data, int[] shape, Allocator? allocator) where T : unmanaged {
             var count = shape.Aggregate(1, (a, b) => a * b);
-            var result = new T[count];
+            var result = (allocator ?? Allocator.Default).Allocate<T>(count, AllocationCategory.Output);
             fixed (void* dst = result)
                 Buffer.MemoryCopy(data, dst, count * sizeof(T), count * sizeof(T));
             return result;
         }
 
+        private static Value CreateBinary (ReadOnlySpan<byte> data, Flags flags) {
+            if (data.IsEmpty) { // pinning an empty span yields a null pointer
+                var empty = stackalloc byte[1];
+                return CreateBinary(empty, 0, flags);
+            }
+            fixed (byte* pointer = data)
+                return CreateBinary(pointer, data.Length, flags);
+        }
+
+        private static Value CreateBinary (byte* data, int length, Flags flags) {
+            CreateBinaryValue(data, length, flags, out var value).Throw();
+            return new Value(value);
+        }
+
+        private static Value CreateMapped (string path, long offset, long length, Func<IntPtr, Value> create) {
+            var fileLength = new FileInfo(path).Length;
+            if (offset < 0 || offset > fileLength || length <= 0 || length > fileLength - offset)
+                throw new ArgumentOutOfRangeException(nameof(length), $"Cannot create value because range [{offset}, {offset + length}) is outside file '{path}' of length {fileLength}");
+            var file = MemoryMappedFile.CreateFromFile(path, FileMode.Open, null, 0, MemoryMappedFileAccess.Read);
+            MemoryMappedViewAccessor? view = null;
+            byte* pointer = null;
+            try {
+                var accessor = view = file.CreateViewAccessor(offset, length, MemoryMappedFileAccess.Read);
+                accessor.SafeMemoryMappedViewHandle.AcquirePointer(ref pointer);
+                var value = create((IntPtr)(pointer + accessor.PointerOffset)); // the runtime borrows the mapped pages
+                value.deallocator = () => {
+                    accessor.SafeMemoryMappedViewHandle.ReleasePointer();
+                    accessor.Dispose();
+                    file.Dispose();
+                };
+                return value;
+            } catch {
+                if (pointer != null)
+                    view!.SafeMemoryMappedViewHandle.ReleasePointer();
+                view?.Dispose();
+                file.Dispose();
+                throw;
+            }
+        }
+
+        private static void ConvertStrided ( // converts the innermost contiguous runs in place, without a dense copy
+            float* src,
+            int[] shape,
+            int[] strides,
+            int axis,
+            Dtype dtype,
+            ref byte* dst
+        ) {
+            var elementSize = GetElementSize(dtype);
+            if (axis == shape.Length - 1) {
+                if (strides[axis] == 1) {
+                    Conversion.Convert(Dtype.Float32, src, dtype, dst, shape[axis]);
+                    dst += (long)shape[axis] * elementSize;
+                } else { // gather the row in chunks so each conversion call stays vectorized
+                    var row = stackalloc float[StridedChunkSize];
+                    for (var i = 0; i < shape[axis]; i += StridedChunkSize) {
+                        var count = Math.Min(StridedChunkSize, shape[axis] - i);
+                        for (var j = 0; j < count; ++j)
+                            row[j] = src[(long)(i + j) * strides[axis]];
+                        Conversion.Convert(Dtype.Float32, row, dtype, dst, count);
+                        dst += (long)count * elementSize;
+                    }
+                }
+                return;
+            }
+            for (var i = 0; i < shape[axis]; ++i)
+                ConvertStrided(src + (long)i * strides[axis], shape, strides, axis + 1, dtype, ref dst);
+        }
+
+        private const int StridedChunkSize = 256;
+
+        private static int CheckBinaryLength (long length) => length <= int.MaxValue ?
+            (int)length :
+            throw new ArgumentOutOfRangeException(nameof(length), $"Cannot create binary value because its length {length} exceeds the 2GB limit of the Function runtime");
+
+        private static int GetElementSize (Dtype dtype) => dtype switch {
+            Dtype.Float16   => sizeof(Float16),
+            Dtype.BFloat16  => sizeof(BFloat16),
+            Dtype.Float32   => sizeof(float),
+            Dtype.Float64   => sizeof(double),
+            Dtype.Int8      => sizeof(sbyte),
+            Dtype.Int16     => sizeof(short),
+            Dtype.Int32     => sizeof(int),
+            Dtype.Int64     => sizeof(long),
+            Dtype.Uint8     => sizeof(byte),
+            Dtype.Uint16    => sizeof(ushort),
+            Dtype.Uint32    => sizeof(uint),
+            Dtype.Uint64    => sizeof(ulong),
+            Dtype.Bool      => sizeof(bool),
+            _               => throw new ArgumentException($"Cannot create array value because type is not a numeric type: {dtype}", nameof(dtype)),
+        };
+
         private static Dtype ToDtype<T> () where T : unmanaged => default(T) switch { // don't use this for reference types
-            float   _ => Dtype.Float32,
-            double  _ => Dtype.Float64,
-            sbyte   _ => Dtype.Int8,
-            short   _ => Dtype.Int16,
-            int     _ => Dtype.Int32,
-            long    _ => Dtype.Int64,
-            byte    _ => Dtype.Uint8,
-            ushort  _ => Dtype.Uint16,
-            uint    _ => Dtype.Uint32,
-            ulong   _ => Dtype.Uint64,
-            bool    _ => Dtype.Bool,
-                    _ => Dtype.Null,
+            Float16     _ => Dtype.Float16,
+            BFloat16    _ => Dtype.BFloat16,
+            float       _ => Dtype.Float32,
+            double      _ => Dtype.Float64,
+            sbyte       _ => Dtype.Int8,
+            short       _ => Dtype.Int16,
+            int         _ => Dtype.Int32,
+            long        _ => Dtype.Int64,
+            byte        _ => Dtype.Uint8,
+            ushort      _ => Dtype.Uint16,
+            uint        _ => Dtype.Uint32,
+            ulong       _ => Dtype.Uint64,
+            bool        _ => Dtype.Bool,
+                        _ => Dtype.Null,
         };
         #endregion
     }
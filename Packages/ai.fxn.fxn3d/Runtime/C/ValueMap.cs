@@ -8,6 +8,7 @@
 namespace Function.C {
 
     using System;
+    using System.Collections.Generic;
     using System.Text;
     using static Function;
 
@@ -17,7 +18,17 @@ namespace Function.C {
 
         public Value this [string key] {
             get => GetValue(key);
-            set => map.SetValueMapValue(key, value).Throw();
+            set {
+                map.SetValueMapValue(key, value).Throw();
+                if (deallocators.TryGetValue(key, out var previous)) { // previous value was released by the map
+                    deallocators.Remove(key);
+                    previous();
+                }
+                if (value.deallocator != null) {
+                    deallocators.Add(key, value.deallocator);
+                    value.deallocator = null;
+                }
+            }
         }
 
         public int size => map.GetValueMapSize(out var size).Throw() == Status.Ok ? size : default;
@@ -35,12 +46,18 @@ namespace Function.C {
             return new Value(value);
         }
 
-        public void Dispose () => map.ReleaseValueMap();
+        public void Dispose () {
+            map.ReleaseValueMap();
+            foreach (var deallocator in deallocators.Values)
+                deallocator();
+            deallocators.Clear();
+        }
         #endregion
 
 
         #region --Operations--
         private readonly IntPtr map;
+        private readonly Dictionary<string, Action> deallocators = new();
 
         internal ValueMap (IntPtr map) => this.map = map;
 
@@ -89,7 +89,7 @@ namespace Function {
             this.Users = new UserService(client);
             this.Predictors = new PredictorService(client);
             this.Predictions = new PredictionService(client);
-            this.Beta = new BetaClient(client);
+            this.Beta = new BetaClient(client, Predictions);
         }
         #endregion
 
@@ -9,10 +9,13 @@ namespace Function.Services {
 
     using System;
     using System.Collections;
+    using System.Collections.Concurrent;
     using System.Collections.Generic;
+    using System.Diagnostics;
     using System.Linq;
     using System.IO;
     using System.Runtime.Serialization;
+    using System.Threading;
     using System.Threading.Tasks;
     using API;
     using Types;
@@ -26,6 +29,17 @@ namespace Function.Services {
     public sealed class PredictionService {
 
         #region --Client API--
+        /// <summary>
+        /// Whether to read prediction logs from the runtime.
+        /// Disable this to avoid copying logs for every prediction in realtime loops.
+        /// </summary>
+        public bool captureLogs { get; set; } = true;
+
+        /// <summary>
+        /// Allocator used for prediction output buffers.
+        /// </summary>
+        public Allocator allocator { get; set; } = Allocator.Default;
+
         /// <summary>
         /// Create a prediction.
         /// </summary>
@@ -46,10 +60,28 @@ namespace Function.Services {
             await Configuration.InitializationTask;
             if (inputs == null)
                 return await CreateRawPrediction(tag, clientId, configurationId);
-            var predictor = await GetPredictor(tag, acceleration, device, clientId, configurationId);
-            using var inputMap = ToValueMap(inputs);
-            using var prediction = predictor.CreatePrediction(inputMap);
-            return ToPrediction(tag, prediction);
+            return await CreatePrediction(tag, inputs, null, acceleration, device, clientId, configurationId);
+        }
+
+        /// <summary>
+        /// Create a prediction from a caller-owned input map.
+        /// The input map is not disposed, so a single map can be reused for every prediction in a realtime loop.
+        /// Values created from native tensors or images without `Flags.CopyData` reference the caller's buffer,
+        /// so writing new data into that buffer before each prediction avoids any native allocations for inputs.
+        /// The buffer must stay pinned and alive for as long as the map is used.
+        /// </summary>
+        /// <param name="tag">Predictor tag.</param>
+        /// <param name="inputs">Input value map.</param>
+        /// <param name="acceleration">Prediction acceleration.</param>
+        /// <param name="device">Prediction device. Do not set this unless you know what you are doing.</param>
+        public async Task<Prediction> Create (
+            string tag,
+            ValueMap inputs,
+            Acceleration acceleration = default,
+            IntPtr device = default
+        ) {
+            await Configuration.InitializationTask;
+            return await CreatePrediction(tag, null, inputs, acceleration, device);
         }
 
         /// <summary>
@@ -66,14 +98,57 @@ namespace Function.Services {
             IntPtr device = default
         ) {
             await Configuration.InitializationTask;
-            var predictor = await GetPredictor(tag, acceleration, device);
-            using var inputMap = ToValueMap(inputs);
-            using var stream = predictor.StreamPrediction(inputMap);
-            foreach (var prediction in stream)
-                using (prediction)
-                    yield return ToPrediction(tag, prediction);
+            var recorder = recorders.GetOrAdd(tag, _ => new PredictionRecorder());
+            var profile = new PredictionProfile();
+            Prediction? result = null;
+            recorder.Start(inputs);
+            try {
+                var watch = Stopwatch.StartNew();
+                var predictor = await GetPredictor(tag, acceleration, device);
+                profile.predictorLoad = Lap(watch, @"LoadPredictor", tag);
+                using var inputMap = ToValueMap(inputs);
+                profile.inputConversion = Lap(watch, @"ConvertInputs", tag);
+                using var stream = predictor.StreamPrediction(inputMap);
+                foreach (var prediction in stream)
+                    using (prediction) {
+                        profile.prediction = Lap(watch, @"StreamPrediction", tag);
+                        var first = result == null;
+                        result = ToPrediction(tag, prediction, captureLogs, allocator);
+                        if (first)
+                            recorder.FirstOutput(result);
+                        profile.outputConversion = Lap(watch, @"ConvertOutputs", tag);
+                        result.profile = profile;
+                        yield return result;
+                        profile = new PredictionProfile();
+                        watch.Restart(); // exclude time spent by the consumer
+                    }
+            } finally {
+                recorder.Complete(result); // the final streamed prediction carries the total latency
+            }
         }
 
+        /// <summary>
+        /// Get runtime statistics for on-device predictions with a predictor.
+        /// Statistics are recorded with lock-free counters, so they cost nothing to collect beyond each prediction.
+        /// </summary>
+        /// <param name="tag">Predictor tag.</param>
+        public PredictionStatistics GetStatistics (string tag) => recorders
+            .GetOrAdd(tag, _ => new PredictionRecorder())
+            .GetStatistics(tag);
+
+        /// <summary>
+        /// Start recording a trace of predictor loading and on-device predictions.
+        /// Spans are kept in a ring buffer, so only the most recent spans are retained.
+        /// </summary>
+        /// <param name="capacity">Maximum number of spans retained.</param>
+        public void StartTrace (int capacity = 16384) => tracer = new PredictionTracer(capacity);
+
+        /// <summary>
+        /// Stop recording a trace.
+        /// </summary>
+        /// <returns>Trace in the Chrome Trace Event JSON format, or `null` if no trace was being recorded.</returns>
+        public string? StopTrace () => Interlocked.Exchange(ref tracer, null)?.Export();
+
         /// <summary>
         /// Delete a predictor that is loaded in memory.
         /// </summary>
@@ -94,6 +169,8 @@ namespace Function.Services {
         private readonly FunctionClient client;
         private readonly string cachePath;
         private readonly Dictionary<string, C.Predictor> cache = new();
+        private readonly ConcurrentDictionary<string, PredictionRecorder> recorders = new();
+        private PredictionTracer? tracer;
 
         internal PredictionService (FunctionClient client) {
             this.client = client;
@@ -104,6 +181,36 @@ namespace Function.Services {
             );
         }
 
+        private async Task<Prediction> CreatePrediction (
+            string tag,
+            Dictionary<string, object?>? inputs,
+            ValueMap? inputMap,
+            Acceleration acceleration = default,
+            IntPtr device = default,
+            string? clientId = default,
+            string? configurationId = default
+        ) {
+            var recorder = recorders.GetOrAdd(tag, _ => new PredictionRecorder());
+            var profile = new PredictionProfile();
+            Prediction? result = null;
+            recorder.Start(inputs);
+            try {
+                var watch = Stopwatch.StartNew();
+                var predictor = await GetPredictor(tag, acceleration, device, clientId, configurationId);
+                profile.predictorLoad = Lap(watch, @"LoadPredictor", tag);
+                using var ownedInputMap = inputMap == null ? ToValueMap(inputs!) : null;
+                profile.inputConversion = Lap(watch, @"ConvertInputs", tag);
+                using var prediction = predictor.CreatePrediction(inputMap ?? ownedInputMap!);
+                profile.prediction = Lap(watch, @"CreatePrediction", tag);
+                result = ToPrediction(tag, prediction, captureLogs, allocator);
+                profile.outputConversion = Lap(watch, @"ConvertOutputs", tag);
+                result.profile = profile;
+                return result;
+            } finally {
+                recorder.Complete(result);
+            }
+        }
+
         private Task<Prediction> CreateRawPrediction (
             string tag,
             string? clientId = default,
@@ -118,6 +225,8 @@ namespace Function.Services {
             }
         )!;
 
+        internal bool IsLoaded (string tag) => cache.ContainsKey(tag);
+
         private async Task<C.Predictor> GetPredictor (
             string tag,
             Acceleration acceleration = default,
@@ -127,19 +236,30 @@ namespace Function.Services {
         ) {
             if (cache.TryGetValue(tag, out var p))
                 return p;
-            var prediction = await CreateRawPrediction(tag, clientId, configurationId);
+            var tracer = this.tracer;
+            Prediction prediction;
+            using (PredictionTracer.Begin(tracer, @"FetchConfiguration", tag))
+                prediction = await CreateRawPrediction(tag, clientId, configurationId);
             using var configuration = new Configuration() {
                 tag = prediction.tag,
                 token = prediction.configuration!,
                 acceleration = acceleration,
                 device = device
             };
-            foreach (var resource in prediction.resources!)
-                await configuration.AddResource(
-                    resource.type,
-                    await DownloadResource(resource)
-                );
-            var predictor = new C.Predictor(configuration);
+            foreach (var resource in prediction.resources!) {
+                string path;
+                using (PredictionTracer.Begin(tracer, @"DownloadResource", resource.name ?? resource.type))
+                    path = await DownloadResource(resource);
+                using (PredictionTracer.Begin(tracer, @"AddResource", resource.name ?? resource.type))
+                    await configuration.AddResource(resource.type, path);
+            }
+            C.Predictor predictor;
+            using (PredictionTracer.Begin(tracer, @"CreatePredictor", tag))
+                try {
+                    predictor = new C.Predictor(configuration);
+                } catch (Exception ex) when (ex is InvalidOperationException || ex is ArgumentException || ex is NotImplementedException) {
+                    throw new PredictorLoadException(tag, ex);
+                }
             cache.Add(tag, predictor);
             return predictor;
         }
@@ -170,6 +290,8 @@ namespace Function.Services {
         internal static unsafe Value ToValue (object? value) => value switch {
             Value           x => x,
             IntPtr          x => new Value(x),
+            Float16         x => Value.CreateArray(x),
+            BFloat16        x => Value.CreateArray(x),
             float           x => Value.CreateArray(x),
             double          x => Value.CreateArray(x),
             sbyte           x => Value.CreateArray(x),
@@ -181,6 +303,8 @@ namespace Function.Services {
             uint            x => Value.CreateArray(x),
             ulong           x => Value.CreateArray(x),
             bool            x => Value.CreateArray(x),
+            Float16[]       x => Value.CreateArray(x),
+            BFloat16[]      x => Value.CreateArray(x),
             float[]         x => Value.CreateArray(x),
             double[]        x => Value.CreateArray(x),
             sbyte[]         x => Value.CreateArray(x),
@@ -192,6 +316,8 @@ namespace Function.Services {
             uint[]          x => Value.CreateArray(x),
             ulong[]         x => Value.CreateArray(x),
             bool[]          x => Value.CreateArray(x),
+            Tensor<Float16> x => Value.CreateArray(x),
+            Tensor<BFloat16> x => Value.CreateArray(x),
             Tensor<float>   x => Value.CreateArray(x),
             Tensor<double>  x => Value.CreateArray(x),
             Tensor<sbyte>   x => Value.CreateArray(x),
@@ -220,7 +346,7 @@ namespace Function.Services {
             return map;
         }
 
-        private static Prediction ToPrediction (string tag, C.Prediction prediction) {
+        private static Prediction ToPrediction (string tag, C.Prediction prediction, bool captureLogs, Allocator allocator) {
             var outputMap = prediction.results;
             return new Prediction {
                 id = prediction.id,
@@ -229,14 +355,21 @@ namespace Function.Services {
                 results = outputMap != null ? Enumerable.Range(0, outputMap.size)
                     .Select(outputMap.GetKey)
                     .Select(outputMap.GetValue)
-                    .Select(value => value.ToObject())
+                    .Select(value => value.ToObject(allocator))
                     .ToArray() : null,
                 latency = prediction.latency,
                 error = prediction.error,
-                logs = prediction.logs,
+                logs = captureLogs ? prediction.logs : null,
             };
         }
 
+        private double Lap (Stopwatch watch, string name, string tag) {
+            var elapsed = watch.Elapsed;
+            tracer?.Add(name, tag, watch.ElapsedTicks);
+            watch.Restart();
+            return elapsed.TotalMilliseconds;
+        }
+
         private static object SerializeEnum (Enum value) {
             var fieldInfo = value.GetType().GetField(value.ToString());
             var attribute = fieldInfo?.GetCustomAttributes(typeof(EnumMemberAttribute), false)?.FirstOrDefault() as EnumMemberAttribute;
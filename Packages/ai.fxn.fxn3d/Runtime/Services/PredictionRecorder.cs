@@ -0,0 +1,186 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Services {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Threading;
+    using Types;
+
+    /// <summary>
+    /// Lock-free prediction counters and latency histogram for a predictor.
+    /// Latencies are bucketed into 8 linear sub-buckets per power of two microseconds,
+    /// so reported percentiles are within 6.25% of the recorded latency.
+    /// </summary>
+    internal sealed class PredictionRecorder {
+
+        #region --Client API--
+        /// <summary>
+        /// Record the start of a prediction.
+        /// </summary>
+        /// <param name="inputs">Input values, or `null` if the inputs are already a native value map.</param>
+        public void Start (Dictionary<string, object?>? inputs) {
+            Interlocked.Increment(ref pending);
+            if (inputs == null)
+                return;
+            var size = 0L;
+            foreach (var pair in inputs)
+                size += SizeOf(pair.Value);
+            Interlocked.Add(ref bytesIn, size);
+        }
+
+        /// <summary>
+        /// Record the first output of a streaming prediction.
+        /// </summary>
+        /// <param name="prediction">First streamed prediction.</param>
+        public void FirstOutput (Prediction prediction) {
+            if (prediction.latency is double latency) {
+                Interlocked.Add(ref firstOutputMicros, ToMicroseconds(latency));
+                Interlocked.Increment(ref firstOutputSamples);
+            }
+        }
+
+        /// <summary>
+        /// Record the end of a prediction.
+        /// Streaming predictions are recorded with the latency of their final output.
+        /// </summary>
+        /// <param name="prediction">Prediction, or `null` if the prediction threw.</param>
+        public void Complete (Prediction? prediction) {
+            Interlocked.Decrement(ref pending);
+            Interlocked.Increment(ref predictions);
+            if (prediction == null || prediction.error != null)
+                Interlocked.Increment(ref errors);
+            if (prediction?.results != null) {
+                var size = 0L;
+                foreach (var result in prediction.results)
+                    size += SizeOf(result);
+                Interlocked.Add(ref bytesOut, size);
+            }
+            if (prediction?.latency is double latency) {
+                var micros = ToMicroseconds(latency);
+                Interlocked.Increment(ref histogram[GetBucket(micros)]);
+                Interlocked.Add(ref totalMicros, micros);
+                Interlocked.Increment(ref samples);
+                long max;
+                while (micros > (max = Interlocked.Read(ref maxMicros)))
+                    if (Interlocked.CompareExchange(ref maxMicros, micros, max) == max)
+                        break;
+            }
+        }
+
+        /// <summary>
+        /// Get a snapshot of the statistics.
+        /// </summary>
+        /// <param name="tag">Predictor tag.</param>
+        public PredictionStatistics GetStatistics (string tag) {
+            var counts = new long[histogram.Length];
+            var count = 0L;
+            for (var i = 0; i < counts.Length; ++i)
+                count += counts[i] = Interlocked.Read(ref histogram[i]);
+            var firstOutputs = Interlocked.Read(ref firstOutputSamples);
+            return new PredictionStatistics {
+                tag = tag,
+                predictions = Interlocked.Read(ref predictions),
+                errors = Interlocked.Read(ref errors),
+                pending = Interlocked.Read(ref pending),
+                bytesIn = Interlocked.Read(ref bytesIn),
+                bytesOut = Interlocked.Read(ref bytesOut),
+                mean = count > 0 ? Interlocked.Read(ref totalMicros) / 1e+3 / Interlocked.Read(ref samples) : null,
+                p50 = GetPercentile(counts, count, 0.50),
+                p95 = GetPercentile(counts, count, 0.95),
+                p99 = GetPercentile(counts, count, 0.99),
+                max = count > 0 ? Interlocked.Read(ref maxMicros) / 1e+3 : null,
+                firstOutput = firstOutputs > 0 ? Interlocked.Read(ref firstOutputMicros) / 1e+3 / firstOutputs : null,
+            };
+        }
+        #endregion
+
+
+        #region --Operations--
+        private const int SubBucketBits = 3;
+        private const int SubBuckets = 1 << SubBucketBits;
+        private readonly long[] histogram = new long[(64 - SubBucketBits + 1) * SubBuckets];
+        private long predictions;
+        private long errors;
+        private long pending;
+        private long bytesIn;
+        private long bytesOut;
+        private long samples;
+        private long totalMicros;
+        private long maxMicros;
+        private long firstOutputSamples;
+        private long firstOutputMicros;
+
+        private static long ToMicroseconds (double latency) => Math.Max((long)(latency * 1e+3), 1L);
+
+        private static int GetBucket (long value) {
+            if (value < 2 * SubBuckets)
+                return (int)value;
+            var magnitude = Log2(value) - SubBucketBits;
+            var subBucket = (int)(value >> magnitude) - SubBuckets;
+            return SubBuckets + magnitude * SubBuckets + subBucket;
+        }
+
+        private static double GetBucketMidpoint (int bucket) {
+            if (bucket < 2 * SubBuckets)
+                return bucket + 0.5;
+            var magnitude = bucket / SubBuckets - 1;
+            var subBucket = bucket % SubBuckets;
+            var lower = (double)(SubBuckets + subBucket) * (1L << magnitude);
+            return lower + (1L << magnitude) / 2.0;
+        }
+
+        private static double? GetPercentile (long[] counts, long count, double percentile) {
+            if (count == 0)
+                return null;
+            var rank = (long)Math.Ceiling(percentile * count);
+            var seen = 0L;
+            for (var i = 0; i < counts.Length; ++i)
+                if ((seen += counts[i]) >= rank)
+                    return GetBucketMidpoint(i) / 1e+3;
+            return null;
+        }
+
+        private static int Log2 (long value) {
+            var result = 0;
+            while ((value >>= 1) != 0)
+                ++result;
+            return result;
+        }
+
+        private static long SizeOf (int[] shape) {
+            var size = 1L;
+            foreach (var dim in shape)
+                size *= dim;
+            return size;
+        }
+
+        private static unsafe long SizeOf (object? value) => value switch {
+            Array           x => Buffer.ByteLength(x),
+            Tensor<Float16> x => SizeOf(x.shape) * sizeof(Float16),
+            Tensor<BFloat16> x => SizeOf(x.shape) * sizeof(BFloat16),
+            Tensor<float>   x => SizeOf(x.shape) * sizeof(float),
+            Tensor<double>  x => SizeOf(x.shape) * sizeof(double),
+            Tensor<sbyte>   x => SizeOf(x.shape) * sizeof(sbyte),
+            Tensor<short>   x => SizeOf(x.shape) * sizeof(short),
+            Tensor<int>     x => SizeOf(x.shape) * sizeof(int),
+            Tensor<long>    x => SizeOf(x.shape) * sizeof(long),
+            Tensor<byte>    x => SizeOf(x.shape) * sizeof(byte),
+            Tensor<ushort>  x => SizeOf(x.shape) * sizeof(ushort),
+            Tensor<uint>    x => SizeOf(x.shape) * sizeof(uint),
+            Tensor<ulong>   x => SizeOf(x.shape) * sizeof(ulong),
+            Tensor<bool>    x => SizeOf(x.shape) * sizeof(bool),
+            string          x => (long)x.Length * sizeof(char),
+            Image           x => (long)x.width * x.height * x.channels,
+            Stream          x => x.CanSeek ? x.Length : 0,
+            _                 => 0,
+        };
+        #endregion
+    }
+}
\ No newline at end of file
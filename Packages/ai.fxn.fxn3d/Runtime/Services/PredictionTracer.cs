@@ -0,0 +1,141 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Services {
+
+    using System;
+    using System.Diagnostics;
+    using System.Globalization;
+    using System.Text;
+    using Newtonsoft.Json;
+
+    /// <summary>
+    /// Ring buffer of timed spans which can be exported in the Chrome Trace Event format.
+    /// Once the buffer is full, the oldest spans are overwritten.
+    /// </summary>
+    internal sealed class PredictionTracer {
+
+        #region --Client API--
+        /// <summary>
+        /// Create a tracer.
+        /// </summary>
+        /// <param name="capacity">Maximum number of spans retained. Must be positive.</param>
+        public PredictionTracer (int capacity) {
+            if (capacity <= 0)
+                throw new ArgumentOutOfRangeException(nameof(capacity), $"Trace capacity must be positive but was {capacity}");
+            this.events = new Event[capacity];
+            this.origin = Stopwatch.GetTimestamp();
+        }
+
+        /// <summary>
+        /// Begin a span which ends when it is disposed.
+        /// </summary>
+        /// <param name="tracer">Tracer. When `null` the span records nothing.</param>
+        /// <param name="name">Span name.</param>
+        /// <param name="detail">Span detail, such as a predictor tag or resource name.</param>
+        public static Span Begin (PredictionTracer? tracer, string name, string? detail = null) => new(tracer, name, detail);
+
+        /// <summary>
+        /// Record a span which has already ended.
+        /// </summary>
+        /// <param name="name">Span name.</param>
+        /// <param name="detail">Span detail, such as a predictor tag or resource name.</param>
+        /// <param name="duration">Span duration in <see cref="Stopwatch"/> ticks, ending now.</param>
+        public void Add (string name, string? detail, long duration) => Add(new Event {
+            name = name,
+            detail = detail,
+            thread = Environment.CurrentManagedThreadId,
+            start = Stopwatch.GetTimestamp() - duration,
+            duration = duration,
+        });
+
+        /// <summary>
+        /// Export recorded spans as Chrome Trace Event JSON.
+        /// The result can be opened in `chrome://tracing` or Perfetto.
+        /// </summary>
+        public string Export () {
+            Event[] snapshot;
+            lock (events) { // copy under the lock so spans ending concurrently are never read half-written
+                var count = (int)Math.Min(next, events.Length);
+                snapshot = new Event[count];
+                for (var i = 0; i < count; ++i)
+                    snapshot[i] = events[(next - count + i) % events.Length];
+            }
+            var builder = new StringBuilder(@"{""traceEvents"":[");
+            var first = true;
+            foreach (var e in snapshot) {
+                if (!first)
+                    builder.Append(',');
+                first = false;
+                builder.Append(@"{""name"":").Append(JsonConvert.ToString(e.name));
+                builder.Append(@",""cat"":""function"",""ph"":""X"",""pid"":1");
+                builder.Append(@",""tid"":").Append(e.thread);
+                builder.Append(@",""ts"":").Append(ToMicroseconds(e.start - origin).ToString(@"F3", CultureInfo.InvariantCulture));
+                builder.Append(@",""dur"":").Append(ToMicroseconds(e.duration).ToString(@"F3", CultureInfo.InvariantCulture));
+                if (e.detail != null)
+                    builder.Append(@",""args"":{""detail"":").Append(JsonConvert.ToString(e.detail)).Append('}');
+                builder.Append('}');
+            }
+            builder.Append(@"],""displayTimeUnit"":""ms""}");
+            return builder.ToString();
+        }
+        #endregion
+
+
+        #region --Types--
+        /// <summary>
+        /// Timed span.
+        /// </summary>
+        public readonly struct Span : IDisposable {
+
+            public Span (PredictionTracer? tracer, string name, string? detail) {
+                this.tracer = tracer;
+                this.name = name;
+                this.detail = detail;
+                this.thread = tracer != null ? Environment.CurrentManagedThreadId : 0;
+                this.start = tracer != null ? Stopwatch.GetTimestamp() : 0;
+            }
+
+            public void Dispose () => tracer?.Add(new Event {
+                name = name,
+                detail = detail,
+                thread = thread,
+                start = start,
+                duration = Stopwatch.GetTimestamp() - start,
+            });
+
+            private readonly PredictionTracer? tracer;
+            private readonly string name;
+            private readonly string? detail;
+            private readonly int thread;
+            private readonly long start;
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly Event[] events;
+        private readonly long origin;
+        private long next;
+
+        private void Add (Event e) {
+            lock (events)
+                events[next++ % events.Length] = e;
+        }
+
+        private static double ToMicroseconds (long ticks) => ticks * 1e+6 / Stopwatch.Frequency;
+
+        private struct Event {
+            public string? name;
+            public string? detail;
+            public int thread;
+            public long start;
+            public long duration;
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+/* 
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Services {
+
+    using System;
+
+    /// <summary>
+    /// Exception raised when the runtime rejects a predictor while creating it on-device.
+    /// </summary>
+    internal sealed class PredictorLoadException : InvalidOperationException {
+
+        public PredictorLoadException (string tag, Exception inner) : base(
+            $"Failed to create predictor {tag} on-device",
+            inner
+        ) { }
+    }
+}
\ No newline at end of file
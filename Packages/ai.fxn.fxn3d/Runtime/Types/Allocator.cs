@@ -0,0 +1,141 @@
+/*
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Types {
+
+    using System;
+    using System.Threading;
+
+    /// <summary>
+    /// Allocator for managed buffers created by Function.
+    /// Derive from this class to route prediction buffers into pooled or tracked memory,
+    /// or use `PooledAllocator` to reuse returned buffers.
+    /// </summary>
+    public class Allocator {
+
+        #region --Client API--
+        /// <summary>
+        /// Default allocator, which allocates new managed arrays.
+        /// </summary>
+        public static readonly Allocator Default = new();
+
+        /// <summary>
+        /// Allocate a managed array.
+        /// </summary>
+        /// <typeparam name="T">Element type.</typeparam>
+        /// <param name="length">Array length.</param>
+        /// <param name="category">Subsystem requesting the allocation.</param>
+        /// <returns>Array with exactly `length` elements.</returns>
+        public unsafe T[] Allocate<T> (int length, AllocationCategory category) where T : unmanaged {
+            var statistics = this.statistics[(int)category];
+            var result = AllocateArray<T>(length);
+            if (result.Length != length)
+                throw new InvalidOperationException($"Allocator returned an array with {result.Length} elements but {length} were requested");
+            Interlocked.Increment(ref statistics.allocations);
+            Interlocked.Add(ref statistics.bytes, (long)length * sizeof(T));
+            Interlocked.Add(ref statistics.liveBytes, (long)length * sizeof(T));
+            return result;
+        }
+
+        /// <summary>
+        /// Return a managed array once it is no longer used, so that it can be reused.
+        /// Do not access the array after returning it.
+        /// </summary>
+        /// <typeparam name="T">Element type.</typeparam>
+        /// <param name="array">Array previously created by `Allocate` with the same category.</param>
+        /// <param name="category">Subsystem which requested the allocation.</param>
+        public unsafe void Return<T> (T[] array, AllocationCategory category) where T : unmanaged {
+            var statistics = this.statistics[(int)category];
+            Interlocked.Increment(ref statistics.returns);
+            Interlocked.Add(ref statistics.liveBytes, -(long)array.Length * sizeof(T));
+            ReturnArray(array);
+        }
+
+        /// <summary>
+        /// Get allocation statistics for a subsystem.
+        /// </summary>
+        /// <param name="category">Subsystem.</param>
+        public AllocationStatistics GetStatistics (AllocationCategory category) {
+            var statistics = this.statistics[(int)category];
+            return new AllocationStatistics {
+                allocations = Interlocked.Read(ref statistics.allocations),
+                returns = Interlocked.Read(ref statistics.returns),
+                bytes = Interlocked.Read(ref statistics.bytes),
+                liveBytes = Interlocked.Read(ref statistics.liveBytes),
+            };
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly Counter[] statistics = new [] { new Counter(), new Counter() };
+
+        /// <summary>
+        /// Allocate a managed array.
+        /// </summary>
+        /// <typeparam name="T">Element type.</typeparam>
+        /// <param name="length">Array length.</param>
+        /// <returns>Array with exactly `length` elements.</returns>
+        protected virtual T[] AllocateArray<T> (int length) where T : unmanaged => new T[length];
+
+        /// <summary>
+        /// Release a managed array which is no longer used.
+        /// The default implementation leaves the array to the garbage collector.
+        /// </summary>
+        /// <typeparam name="T">Element type.</typeparam>
+        /// <param name="array">Array to release.</param>
+        protected virtual void ReturnArray<T> (T[] array) where T : unmanaged { }
+
+        private sealed class Counter {
+            public long allocations;
+            public long returns;
+            public long bytes;
+            public long liveBytes;
+        }
+        #endregion
+    }
+
+    /// <summary>
+    /// Subsystem requesting a managed allocation.
+    /// </summary>
+    public enum AllocationCategory : int {
+        /// <summary>
+        /// Output values copied from an on-device prediction.
+        /// </summary>
+        Output = 0,
+        /// <summary>
+        /// Output values downloaded for a remote prediction.
+        /// </summary>
+        Remote = 1,
+    }
+
+    /// <summary>
+    /// Allocation statistics for a subsystem.
+    /// </summary>
+    public struct AllocationStatistics {
+
+        /// <summary>
+        /// Number of allocations.
+        /// </summary>
+        public long allocations;
+
+        /// <summary>
+        /// Number of arrays returned to the allocator.
+        /// </summary>
+        public long returns;
+
+        /// <summary>
+        /// Total bytes allocated.
+        /// </summary>
+        public long bytes;
+
+        /// <summary>
+        /// Bytes allocated and not yet returned.
+        /// </summary>
+        public long liveBytes;
+    }
+}
\ No newline at end of file
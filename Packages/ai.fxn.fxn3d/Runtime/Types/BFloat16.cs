@@ -0,0 +1,62 @@
+/*
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Types {
+
+    using System;
+    using System.Runtime.CompilerServices;
+
+    /// <summary>
+    /// Brain floating point float, with the range of a float and 8 bits of precision.
+    /// </summary>
+    [Preserve]
+    public unsafe readonly struct BFloat16 : IEquatable<BFloat16> {
+
+        #region --Client API--
+        /// <summary>
+        /// Raw bfloat16 bits.
+        /// </summary>
+        public readonly ushort bits;
+
+        /// <summary>
+        /// Create a bfloat16 from its raw bits.
+        /// </summary>
+        /// <param name="bits">Raw bfloat16 bits.</param>
+        public BFloat16 (ushort bits) => this.bits = bits;
+
+        /// <summary>
+        /// Convert a float to bfloat16, rounding to nearest even.
+        /// </summary>
+        /// <param name="value">Float.</param>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static explicit operator BFloat16 (float value) {
+            var bits = *(uint*)&value;
+            if ((bits & 0x7FFFFFFFu) > 0x7F800000u) // keep nan quiet instead of rounding it to inf
+                return new BFloat16((ushort)((bits >> 16) | 0x40));
+            return new BFloat16((ushort)((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16));
+        }
+
+        /// <summary>
+        /// Convert a bfloat16 to a float.
+        /// </summary>
+        /// <param name="value">Bfloat16.</param>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static implicit operator float (BFloat16 value) {
+            var bits = (uint)value.bits << 16;
+            return *(float*)&bits;
+        }
+
+        public bool Equals (BFloat16 other) => bits == other.bits;
+
+        public override bool Equals (object? obj) => obj is BFloat16 other && Equals(other);
+
+        public override int GetHashCode () => bits.GetHashCode();
+
+        public override string ToString () => ((float)this).ToString();
+        #endregion
+    }
+}
\ No newline at end of file
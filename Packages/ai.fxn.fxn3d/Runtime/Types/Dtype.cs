@@ -20,7 +20,7 @@ namespace Function.Types {
         [EnumMember(Value = @"null")]
         Null = 0,
         /// <summary>
-        /// Type is a generic half-precision float.
+        /// Type is an IEEE half-precision float, or `Float16` in C#.
         /// </summary>
         [EnumMember(Value = @"float16")]
         Float16 = 1,
@@ -105,14 +105,9 @@ namespace Function.Types {
         [EnumMember(Value = @"binary")]
         Binary = 17,
         /// <summary>
-        /// Type is an encoded audio.
+        /// Type is a brain floating point half-precision float, or `BFloat16` in C#.
         /// </summary>
-        [EnumMember(Value = @"audio")]
-        Audio = 18,
-        /// <summary>
-        /// Type is an encoded video.
-        /// </summary>
-        [EnumMember(Value = @"video")]
-        Video = 19,        
+        [EnumMember(Value = @"bfloat16")]
+        BFloat16 = 18,
     }
 }
\ No newline at end of file
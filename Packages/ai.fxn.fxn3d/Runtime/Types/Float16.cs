@@ -0,0 +1,92 @@
+/*
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Types {
+
+    using System;
+    using System.Runtime.CompilerServices;
+
+    /// <summary>
+    /// IEEE 754 half-precision float.
+    /// </summary>
+    [Preserve]
+    public unsafe readonly struct Float16 : IEquatable<Float16> {
+
+        #region --Client API--
+        /// <summary>
+        /// Raw half-precision bits.
+        /// </summary>
+        public readonly ushort bits;
+
+        /// <summary>
+        /// Create a half-precision float from its raw bits.
+        /// </summary>
+        /// <param name="bits">Raw half-precision bits.</param>
+        public Float16 (ushort bits) => this.bits = bits;
+
+        /// <summary>
+        /// Convert a float to half precision, rounding to nearest even.
+        /// </summary>
+        /// <param name="value">Float.</param>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static explicit operator Float16 (float value) {
+            var bits = *(uint*)&value;
+            var sign = bits & 0x80000000u;
+            bits ^= sign;
+            uint result;
+            if (bits >= (127 + 16) << 23)
+                result = bits > 255u << 23 ? 0x7E00u : 0x7C00u;
+            else if (bits < 113 << 23) {
+                var denormal = *(float*)&bits + DenormalMagic;
+                result = *(uint*)&denormal - DenormalMagicBits;
+            } else {
+                var odd = (bits >> 13) & 1;
+                bits += unchecked((uint)((15 - 127) << 23)) + 0xFFF + odd;
+                result = bits >> 13;
+            }
+            return new Float16((ushort)(result | (sign >> 16)));
+        }
+
+        /// <summary>
+        /// Convert a half-precision float to a float.
+        /// </summary>
+        /// <param name="value">Half-precision float.</param>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static implicit operator float (Float16 value) {
+            var bits = (uint)(value.bits & 0x7FFF) << 13;
+            var exponent = bits & 0x0F800000u;
+            bits += (127 - 15) << 23;
+            if (exponent == 0x0F800000u)
+                bits += (128 - 16) << 23;
+            else if (exponent == 0) {
+                bits += 1 << 23;
+                var denormal = *(float*)&bits - DenormalBias;
+                bits = *(uint*)&denormal;
+            }
+            bits |= (uint)(value.bits & 0x8000) << 16;
+            return *(float*)&bits;
+        }
+
+        public bool Equals (Float16 other) => bits == other.bits;
+
+        public override bool Equals (object? obj) => obj is Float16 other && Equals(other);
+
+        public override int GetHashCode () => bits.GetHashCode();
+
+        public override string ToString () => ((float)this).ToString();
+        #endregion
+
+
+        #region --Operations--
+        private const uint DenormalMagicBits = ((127 - 15) + (23 - 10) + 1) << 23;
+        private static readonly float DenormalMagic = BitsToFloat(DenormalMagicBits);
+        private static readonly float DenormalBias = BitsToFloat(113 << 23);
+
+        private static float BitsToFloat (uint bits) => *(float*)&bits;
+        #endregion
+    }
+}
\ No newline at end of file
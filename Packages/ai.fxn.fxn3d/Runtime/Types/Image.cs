@@ -7,6 +7,7 @@
 
 namespace Function.Types {
 
+    using System;
     using Newtonsoft.Json;
 
     /// <summary>
@@ -35,8 +36,27 @@ namespace Function.Types {
 
         /// <summary>
         /// Image channels.
+        /// For images that are converted when passed to a predictor, this is the converted channel count.
         /// </summary>
         public readonly int channels;
+
+        /// <summary>
+        /// Pixel buffer format.
+        /// </summary>
+        [JsonIgnore]
+        public readonly PixelFormat format;
+
+        /// <summary>
+        /// Pixel buffer row stride in bytes.
+        /// </summary>
+        [JsonIgnore]
+        public readonly int rowStride;
+
+        /// <summary>
+        /// Whether the pixel buffer rows are stored bottom to top.
+        /// </summary>
+        [JsonIgnore]
+        public readonly bool flip;
         
         /// <summary>
         /// Create an image.
@@ -51,6 +71,33 @@ namespace Function.Types {
             this.width = width;
             this.height = height;
             this.channels = channels;
+            this.format = channels switch { 1 => PixelFormat.R8, 3 => PixelFormat.RGB888, _ => PixelFormat.RGBA8888 };
+            this.rowStride = width * channels;
+            this.flip = false;
+        }
+
+        /// <summary>
+        /// Create an image from a pixel buffer in any supported format.
+        /// The pixel buffer is converted to `R8`, `RGB888`, or `RGBA8888` in a single pass when it is passed to a predictor.
+        /// </summary>
+        /// <param name="data">Pixel buffer.</param>
+        /// <param name="width">Image width.</param>
+        /// <param name="height">Image height.</param>
+        /// <param name="format">Pixel buffer format.</param>
+        /// <param name="rowStride">Pixel buffer row stride in bytes, including any row padding.</param>
+        /// <param name="flip">Whether the pixel buffer rows are stored bottom to top.</param>
+        public Image (byte[] data, int width, int height, PixelFormat format, int rowStride, bool flip = false) {
+            this.data = data;
+            this.nativeData = null;
+            this.width = width;
+            this.height = height;
+            this.channels = GetChannels(format);
+            this.format = format;
+            this.rowStride = CheckRowStride(width, format, rowStride);
+            this.flip = flip;
+            var size = GetBufferSize(height, format, rowStride);
+            if (data.Length < size)
+                throw new ArgumentException($"Image pixel buffer length was expected to be greater than or equal to {size} but got {data.Length}", nameof(data));
         }
 
         /// <summary>
@@ -67,6 +114,34 @@ namespace Function.Types {
             this.width = width;
             this.height = height;
             this.channels = channels;
+            this.format = channels switch { 1 => PixelFormat.R8, 3 => PixelFormat.RGB888, _ => PixelFormat.RGBA8888 };
+            this.rowStride = width * channels;
+            this.flip = false;
+        }
+
+        /// <summary>
+        /// Create an image from a pixel buffer in any supported format.
+        /// NOTE: DO NOT use this overload unless you absolutely know what you are doing.
+        /// </summary>
+        /// <param name="data">Pixel buffer.</param>
+        /// <param name="width">Image width.</param>
+        /// <param name="height">Image height.</param>
+        /// <param name="format">Pixel buffer format.</param>
+        /// <param name="rowStride">Pixel buffer row stride in bytes, including any row padding.</param>
+        /// <param name="length">Pixel buffer length in bytes.</param>
+        /// <param name="flip">Whether the pixel buffer rows are stored bottom to top.</param>
+        public unsafe Image (byte* data, int width, int height, PixelFormat format, int rowStride, long length, bool flip = false) {
+            this.data = null!;
+            this.nativeData = data;
+            this.width = width;
+            this.height = height;
+            this.channels = GetChannels(format);
+            this.format = format;
+            this.rowStride = CheckRowStride(width, format, rowStride);
+            this.flip = flip;
+            var size = GetBufferSize(height, format, rowStride);
+            if (length < size)
+                throw new ArgumentException($"Image pixel buffer length was expected to be greater than or equal to {size} but got {length}", nameof(length));
         }
         #endregion
 
@@ -88,6 +163,98 @@ namespace Function.Types {
         }
         
         public ref byte GetPinnableReference () => ref (nativeData == null ? ref data[0] : ref *nativeData);
+
+        /// <summary>
+        /// Whether the pixel buffer is tightly packed `R8`, `RGB888`, or `RGBA8888` in top to bottom row order.
+        /// </summary>
+        internal bool packed => !flip && rowStride == width * channels && format switch {
+            PixelFormat.R8          => true,
+            PixelFormat.RGB888      => true,
+            PixelFormat.RGBA8888    => true,
+            _                       => false,
+        };
+
+        /// <summary>
+        /// Convert the pixel buffer into a tightly packed buffer in top to bottom row order.
+        /// </summary>
+        /// <param name="dst">Destination buffer with room for `width * height * channels` bytes.</param>
+        internal void CopyTo (byte* dst) {
+            var dstStride = width * channels;
+            var chromaStride = format == PixelFormat.I420 ? (rowStride + 1) / 2 : rowStride;
+            fixed (byte* src = this) {
+                var chroma = src + (long)rowStride * height;
+                var chromaPlane = (long)chromaStride * ((height + 1) / 2);
+                for (var y = 0; y < height; ++y) {
+                    var srcY = flip ? height - 1 - y : y;
+                    var srcRow = src + (long)srcY * rowStride;
+                    var chromaRow = chroma + (long)(srcY / 2) * chromaStride;
+                    var dstRow = dst + (long)y * dstStride;
+                    switch (format) {
+                        case PixelFormat.BGRA8888:  SwizzleRow(srcRow, dstRow, width); break;
+                        case PixelFormat.NV12:      ConvertRow(srcRow, chromaRow, chromaRow + 1, 2, dstRow, width); break;
+                        case PixelFormat.NV21:      ConvertRow(srcRow, chromaRow + 1, chromaRow, 2, dstRow, width); break;
+                        case PixelFormat.I420:      ConvertRow(srcRow, chromaRow, chromaRow + chromaPlane, 1, dstRow, width); break;
+                        default:                    Buffer.MemoryCopy(srcRow, dstRow, dstStride, dstStride); break;
+                    }
+                }
+            }
+        }
+
+        private static void SwizzleRow (byte* src, byte* dst, int width) {
+            for (var x = 0; x < width; ++x, src += 4, dst += 4) {
+                dst[0] = src[2];
+                dst[1] = src[1];
+                dst[2] = src[0];
+                dst[3] = src[3];
+            }
+        }
+
+        private static void ConvertRow (byte* luma, byte* u, byte* v, int chromaStep, byte* dst, int width) { // BT.601 video range
+            for (var x = 0; x < width; ++x, dst += 3) {
+                var offset = (x >> 1) * chromaStep;
+                var c = 298 * (luma[x] - 16) + 128;
+                var d = u[offset] - 128;
+                var e = v[offset] - 128;
+                dst[0] = Saturate((c + 409 * e) >> 8);
+                dst[1] = Saturate((c - 100 * d - 208 * e) >> 8);
+                dst[2] = Saturate((c + 516 * d) >> 8);
+            }
+        }
+
+        private static byte Saturate (int value) => (byte)(value < 0 ? 0 : value > 255 ? 255 : value);
+
+        private static int GetChannels (PixelFormat format) => format switch {
+            PixelFormat.R8          => 1,
+            PixelFormat.RGB888      => 3,
+            PixelFormat.RGBA8888    => 4,
+            PixelFormat.BGRA8888    => 4,
+            PixelFormat.NV12        => 3,
+            PixelFormat.NV21        => 3,
+            PixelFormat.I420        => 3,
+            _                       => throw new ArgumentException($"Image pixel format is unsupported: {format}", nameof(format)),
+        };
+
+        private static int CheckRowStride (int width, PixelFormat format, int rowStride) {
+            var minStride = format switch {
+                PixelFormat.NV12    => width + (width & 1),
+                PixelFormat.NV21    => width + (width & 1),
+                PixelFormat.I420    => width,
+                _                   => width * GetChannels(format),
+            };
+            if (rowStride < minStride)
+                throw new ArgumentException($"Image row stride was expected to be greater than or equal to {minStride} but got {rowStride}", nameof(rowStride));
+            return rowStride;
+        }
+
+        private static long GetBufferSize (int height, PixelFormat format, int rowStride) {
+            var chromaHeight = (height + 1) / 2;
+            return format switch {
+                PixelFormat.NV12    => (long)rowStride * (height + chromaHeight),
+                PixelFormat.NV21    => (long)rowStride * (height + chromaHeight),
+                PixelFormat.I420    => (long)rowStride * height + 2L * ((rowStride + 1) / 2) * chromaHeight,
+                _                   => (long)rowStride * height,
+            };
+        }
         #endregion
     }
 }
\ No newline at end of file
@@ -0,0 +1,50 @@
+/*
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Types {
+
+    /// <summary>
+    /// Image pixel format.
+    /// </summary>
+    public enum PixelFormat : int {
+        /// <summary>
+        /// Single channel, 8bpp.
+        /// </summary>
+        R8 = 0,
+        /// <summary>
+        /// Interleaved RGB, 24bpp.
+        /// </summary>
+        RGB888 = 1,
+        /// <summary>
+        /// Interleaved RGBA, 32bpp.
+        /// </summary>
+        RGBA8888 = 2,
+        /// <summary>
+        /// Interleaved BGRA, 32bpp.
+        /// This is converted to `RGBA8888`.
+        /// </summary>
+        BGRA8888 = 3,
+        /// <summary>
+        /// Bi-planar YUV 4:2:0 with a full resolution Y plane followed by an interleaved UV plane.
+        /// Both planes share the image row stride. BT.601 video range is assumed.
+        /// This is converted to `RGB888`.
+        /// </summary>
+        NV12 = 4,
+        /// <summary>
+        /// Bi-planar YUV 4:2:0 with a full resolution Y plane followed by an interleaved VU plane.
+        /// Both planes share the image row stride. BT.601 video range is assumed.
+        /// This is converted to `RGB888`.
+        /// </summary>
+        NV21 = 5,
+        /// <summary>
+        /// Planar YUV 4:2:0 with a full resolution Y plane followed by half resolution U and V planes.
+        /// The chroma planes have half the image row stride. BT.601 video range is assumed.
+        /// This is converted to `RGB888`.
+        /// </summary>
+        I420 = 6,
+    }
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+/*
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Types {
+
+    using System;
+    using System.Collections.Concurrent;
+    using System.Threading;
+
+    /// <summary>
+    /// Allocator which reuses returned arrays of the same type and length.
+    /// Return prediction output buffers with `Allocator.Return` once they are no longer used.
+    /// </summary>
+    public sealed class PooledAllocator : Allocator {
+
+        #region --Client API--
+        /// <summary>
+        /// Maximum number of bytes retained by the pool.
+        /// </summary>
+        public long capacity { get; }
+
+        /// <summary>
+        /// Number of bytes currently retained by the pool.
+        /// </summary>
+        public long pooledBytes => Interlocked.Read(ref size);
+
+        /// <summary>
+        /// Create a pooled allocator.
+        /// </summary>
+        /// <param name="capacity">Maximum number of bytes retained by the pool.</param>
+        public PooledAllocator (long capacity = 256L * 1024 * 1024) => this.capacity = capacity;
+        #endregion
+
+
+        #region --Operations--
+        private readonly ConcurrentDictionary<(Type, int), ConcurrentBag<Array>> pools = new();
+        private long size;
+
+        protected override unsafe T[] AllocateArray<T> (int length) {
+            if (pools.TryGetValue((typeof(T), length), out var pool) && pool.TryTake(out var array)) {
+                Interlocked.Add(ref size, -(long)length * sizeof(T));
+                return (T[])array;
+            }
+            return new T[length];
+        }
+
+        protected override unsafe void ReturnArray<T> (T[] array) {
+            var bytes = (long)array.Length * sizeof(T);
+            if (Interlocked.Add(ref size, bytes) > capacity) {
+                Interlocked.Add(ref size, -bytes);
+                return;
+            }
+            pools.GetOrAdd((typeof(T), array.Length), _ => new ConcurrentBag<Array>()).Add(array);
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -52,9 +52,16 @@ namespace Function.Types {
 
         /// <summary>
         /// Prediction logs.
+        /// On-device predictions only have logs when `fxn.Predictions.captureLogs` is enabled.
         /// </summary>
         public string? logs;
 
+        /// <summary>
+        /// Prediction timing breakdown.
+        /// This is only populated for predictions made on-device.
+        /// </summary>
+        public PredictionProfile? profile;
+
         /// <summary>
         /// Predictor resources.
         /// </summary>
@@ -88,6 +95,105 @@ namespace Function.Types {
         public string? name;
     }
 
+    /// <summary>
+    /// Prediction timing breakdown.
+    /// All timings are wall-clock times in milliseconds measured on the calling thread.
+    /// </summary>
+    [Preserve, Serializable]
+    public class PredictionProfile {
+
+        /// <summary>
+        /// Time spent fetching the predictor configuration, downloading resources, and loading the predictor.
+        /// This is zero when the predictor is already loaded.
+        /// </summary>
+        public double predictorLoad;
+
+        /// <summary>
+        /// Time spent converting input values into Function values.
+        /// </summary>
+        public double inputConversion;
+
+        /// <summary>
+        /// Time spent in the native runtime making the prediction.
+        /// This includes the prediction `latency` along with any native pre- and post-processing.
+        /// </summary>
+        public double prediction;
+
+        /// <summary>
+        /// Time spent converting Function values into output values.
+        /// </summary>
+        public double outputConversion;
+    }
+
+    /// <summary>
+    /// Runtime statistics for on-device predictions with a predictor.
+    /// </summary>
+    [Preserve, Serializable]
+    public class PredictionStatistics {
+
+        /// <summary>
+        /// Predictor tag.
+        /// </summary>
+        public string tag;
+
+        /// <summary>
+        /// Number of completed predictions, including failed predictions.
+        /// </summary>
+        public long predictions;
+
+        /// <summary>
+        /// Number of failed predictions.
+        /// </summary>
+        public long errors;
+
+        /// <summary>
+        /// Number of predictions in flight.
+        /// </summary>
+        public long pending;
+
+        /// <summary>
+        /// Total size of input tensors, strings, and binary values in bytes.
+        /// </summary>
+        public long bytesIn;
+
+        /// <summary>
+        /// Total size of output tensors, strings, and binary values in bytes.
+        /// </summary>
+        public long bytesOut;
+
+        /// <summary>
+        /// Mean prediction latency in milliseconds.
+        /// Streaming predictions are measured up to their final output.
+        /// </summary>
+        public double? mean;
+
+        /// <summary>
+        /// Median prediction latency in milliseconds.
+        /// </summary>
+        public double? p50;
+
+        /// <summary>
+        /// 95th percentile prediction latency in milliseconds.
+        /// </summary>
+        public double? p95;
+
+        /// <summary>
+        /// 99th percentile prediction latency in milliseconds.
+        /// </summary>
+        public double? p99;
+
+        /// <summary>
+        /// Maximum prediction latency in milliseconds.
+        /// </summary>
+        public double? max;
+
+        /// <summary>
+        /// Mean time to the first output of streaming predictions in milliseconds.
+        /// This is `null` if no streaming prediction has produced an output.
+        /// </summary>
+        public double? firstOutput;
+    }
+
     /// <summary>
     /// Prediction acceleration.
     /// </summary>
@@ -7,6 +7,9 @@
 
 namespace Function.Types {
 
+    using System;
+    using System.Linq;
+
     /// <summary>
     /// Tensor.
     /// </summary>
@@ -24,6 +27,17 @@ namespace Function.Types {
         /// </summary>
         public readonly int[] shape;
 
+        /// <summary>
+        /// Tensor strides in elements, not bytes.
+        /// This is `null` when the tensor is contiguous in row-major order.
+        /// </summary>
+        public readonly int[]? strides;
+
+        /// <summary>
+        /// Index of the first tensor element in the tensor data.
+        /// </summary>
+        public readonly int offset;
+
         /// <summary>
         /// Create a tensor.
         /// </summary>
@@ -33,6 +47,24 @@ namespace Function.Types {
             this.data = data;
             this.nativeData = null;
             this.shape = shape;
+            this.strides = null;
+            this.offset = 0;
+        }
+
+        /// <summary>
+        /// Create a strided view of tensor data.
+        /// This can describe crops, channel slices, and transposes without copying the data.
+        /// </summary>
+        /// <param name="data">Tensor data.</param>
+        /// <param name="shape">Tensor shape.</param>
+        /// <param name="strides">Tensor strides in elements. Strides must not be negative.</param>
+        /// <param name="offset">Index of the first tensor element in the tensor data.</param>
+        public Tensor (T[] data, int[] shape, int[] strides, int offset = 0) {
+            this.data = data;
+            this.nativeData = null;
+            this.shape = shape;
+            this.strides = CheckStrides(shape, strides, offset, data.Length);
+            this.offset = offset;
         }
 
         /// <summary>
@@ -45,14 +77,124 @@ namespace Function.Types {
             this.data = null!;
             this.nativeData = data;
             this.shape = shape;
+            this.strides = null;
+            this.offset = 0;
+        }
+
+        /// <summary>
+        /// Create a strided view of tensor data.
+        /// NOTE: DO NOT use this overload unless you absolutely know what you are doing.
+        /// </summary>
+        /// <param name="data">Tensor data.</param>
+        /// <param name="shape">Tensor shape.</param>
+        /// <param name="strides">Tensor strides in elements. Strides must not be negative.</param>
+        /// <param name="length">Number of elements in the tensor data buffer.</param>
+        public Tensor (T* data, int[] shape, int[] strides, long length) {
+            this.data = null!;
+            this.nativeData = data;
+            this.shape = shape;
+            this.strides = CheckStrides(shape, strides, 0, length);
+            this.offset = 0;
         }
         #endregion
 
 
         #region --Operations--
-        private readonly T* nativeData;
+        internal readonly T* nativeData;
+
+        public ref T GetPinnableReference () => ref (nativeData == null ? ref data[offset] : ref *nativeData);
+
+        /// <summary>
+        /// Whether the tensor data is contiguous in row-major order.
+        /// </summary>
+        internal bool contiguous {
+            get {
+                if (strides == null)
+                    return true;
+                var expected = 1L;
+                for (var i = shape.Length - 1; i >= 0; --i) {
+                    if (shape[i] != 1 && strides[i] != expected)
+                        return false;
+                    expected *= shape[i];
+                }
+                return true;
+            }
+        }
+
+        /// <summary>
+        /// Number of tensor elements.
+        /// </summary>
+        internal long count {
+            get {
+                var count = 1L;
+                foreach (var dim in shape)
+                    count *= dim;
+                return count;
+            }
+        }
+
+        /// <summary>
+        /// Whether the tensor data array holds exactly the tensor elements in row-major order.
+        /// </summary>
+        internal bool dense => nativeData == null && offset == 0 && data.Length == count && contiguous;
+
+        /// <summary>
+        /// Copy the tensor elements into a contiguous row-major buffer.
+        /// </summary>
+        /// <param name="dst">Destination buffer with room for every tensor element.</param>
+        internal void CopyTo (T* dst) {
+            fixed (T* src = this)
+                if (contiguous) {
+                    var size = count * sizeof(T);
+                    Buffer.MemoryCopy(src, dst, size, size);
+                }
+                else
+                    Gather(src, dst, 0);
+        }
+
+        /// <summary>
+        /// Get the tensor elements as a contiguous row-major array, copying only when necessary.
+        /// </summary>
+        internal T[] ToArray () {
+            if (dense)
+                return data;
+            var result = new T[count];
+            fixed (T* dst = result)
+                CopyTo(dst);
+            return result;
+        }
 
-        public ref T GetPinnableReference () => ref (nativeData == null ? ref data[0] : ref *nativeData);
+        private T* Gather (T* src, T* dst, int axis) {
+            var stride = (long)strides![axis];
+            if (axis == shape.Length - 1 && stride == 1) {
+                var size = (long)shape[axis] * sizeof(T);
+                Buffer.MemoryCopy(src, dst, size, size);
+                return dst + shape[axis];
+            }
+            for (var i = 0; i < shape[axis]; ++i)
+                if (axis == shape.Length - 1)
+                    *dst++ = src[i * stride];
+                else
+                    dst = Gather(src + i * stride, dst, axis + 1);
+            return dst;
+        }
+
+        private static int[] CheckStrides (int[] shape, int[] strides, int offset, long length) {
+            if (strides.Length != shape.Length)
+                throw new ArgumentException($"Tensor strides must have {shape.Length} dimensions but has {strides.Length}", nameof(strides));
+            if (strides.Any(stride => stride < 0))
+                throw new ArgumentException(@"Tensor strides must not be negative", nameof(strides));
+            if (offset < 0)
+                throw new ArgumentOutOfRangeException(nameof(offset), @"Tensor offset must not be negative");
+            if (shape.Any(dim => dim == 0))
+                return strides;
+            var extent = offset + 1L; // one past the largest reachable element offset
+            for (var i = 0; i < shape.Length; ++i)
+                extent += (long)(shape[i] - 1) * strides[i];
+            if (extent > length)
+                throw new ArgumentOutOfRangeException(nameof(strides), $"Tensor shape and strides reach element {extent - 1} but data only has {length} elements");
+            return strides;
+        }
         #endregion
     }
 }
\ No newline at end of file
@@ -14,6 +14,7 @@ namespace Function.API {
     using System.Threading.Tasks;
     using UnityEngine;
     using Newtonsoft.Json;
+    using Internal;
     using Services;
     using Types;
 
@@ -77,6 +78,10 @@ namespace Function.API {
             var cachedPrediction = TryLoadCachedPrediction(cachePath);
             if (cachedPrediction != null)
                 return cachedPrediction as T;
+            // Get embedded prediction
+            var embeddedPrediction = TryLoadEmbeddedPrediction(tag, clientId);
+            if (embeddedPrediction != null)
+                return embeddedPrediction as T;
             // Create prediction
             var predictionId = cache.FirstOrDefault(p => p.tag == tag && p.clientId == clientId)?.id;
             var prediction = await base.Request<Prediction>(
@@ -111,6 +116,9 @@ namespace Function.API {
             Path.Combine(Application.persistentDataPath, @"fxn");
         private static string ResourceCachePath => Path.Combine(CacheRoot, @"cache");
         private static string PredictorCachePath => Path.Combine(CacheRoot, @"predictors");
+        private static readonly Lazy<PredictorBundle?> embedBundle = new(() => PredictorBundle.Open(
+            GetEmbedBundlePath(Application.streamingAssetsPath)
+        ));
 
         private async Task<PredictionResource> GetCachedResource (PredictionResource resource) {
             var path = PredictionService.GetResourcePath(resource, ResourceCachePath);
@@ -140,6 +148,17 @@ namespace Function.API {
             prediction.resources = resources;
             return prediction;
         }
+
+        private static Prediction? TryLoadEmbeddedPrediction ( // resources are loaded in place from streaming assets
+            string tag,
+            string clientId
+        ) => embedBundle.Value?.GetPrediction(tag, clientId);
+
+        internal static string GetEmbedBundlePath (string streamingAssetsPath) => Path.Combine(
+            streamingAssetsPath,
+            @"fxn",
+            $"predictors{PredictorBundle.Extension}"
+        );
         #endregion
     }
 }
\ No newline at end of file
@@ -8,10 +8,13 @@
 namespace Function.API {
 
     using System;
+    using System.Collections.Concurrent;
     using System.Collections.Generic;
     using System.IO;
     using System.Text;
+    using System.Threading;
     using System.Threading.Tasks;
+    using Unity.Collections;
     using UnityEngine.Networking;
     using Newtonsoft.Json;
 
@@ -62,17 +65,19 @@ namespace Function.API {
                 foreach (var header in headers)
                     client.SetRequestHeader(header.Key, header.Value);
             // Add payload
+            string? encoding = null;
             if (payload != null) {
-                var serializationSettings = new JsonSerializerSettings { NullValueHandling = NullValueHandling.Ignore };
-                var payloadStr = JsonConvert.SerializeObject(payload, serializationSettings);
+                var payloadData = SerializePayload(payload, out encoding);
                 client.SetRequestHeader(@"Content-Type",  @"application/json");
-                client.uploadHandler = new UploadHandlerRaw(Encoding.UTF8.GetBytes(payloadStr));
+                if (encoding != null)
+                    client.SetRequestHeader(@"Content-Encoding", encoding);
+                client.uploadHandler = new UploadHandlerRaw(payloadData);
             }
             // Request
-            client.SendWebRequest();
-            while (!client.isDone)
-                await Task.Yield();
+            await SendWebRequest(client);
             // Check error
+            if (encoding != null && RejectCompression((int)client.responseCode))
+                return await Request<T>(method, path, payload, headers);
             var responseStr = client.downloadHandler.text;
             if (client.responseCode == 0)
                 throw new FunctionAPIException(
@@ -95,9 +100,7 @@ namespace Function.API {
         public override async Task<Stream> Download (string url) {
             using var request = UnityWebRequest.Get(url);
             request.timeout = 20;
-            request.SendWebRequest();
-            while (!request.isDone)
-                await Task.Yield();
+            await SendWebRequest(request);
             if (request.result != UnityWebRequest.Result.Success)
                 throw new InvalidOperationException(request.error);
             var data = request.downloadHandler.data;
@@ -113,30 +116,192 @@ namespace Function.API {
         /// <param name="mime">MIME type.</param>
         public override async Task Upload (Stream stream, string url, string? mime = null) {
             using var client = new UnityWebRequest(url, UnityWebRequest.kHttpVerbPUT) {
-                uploadHandler = new UploadHandlerRaw(ToArray(stream)),
+                uploadHandler = CreateUploadHandler(stream),
                 downloadHandler = new DownloadHandlerBuffer(),
                 disposeDownloadHandlerOnDispose = true,
                 disposeUploadHandlerOnDispose = true,
                 timeout = 20,
             };
             client.SetRequestHeader(@"Content-Type", mime ?? @"application/octet-stream");
-            client.SendWebRequest();
-            while (!client.isDone)
-                await Task.Yield();
+            await SendWebRequest(client);
             if (client.error != null)
                 throw new InvalidOperationException($"Failed to upload stream with error: {client.error}");
         }
+
+        /// <summary>
+        /// Make a request to a REST endpoint and consume the server-sent events in the response.
+        /// </summary>
+        /// <typeparam name="T">Deserialized event type.</typeparam>
+        /// <param name="method">HTTP request method.</param>
+        /// <param name="path">Endpoint path.</param>
+        /// <param name="payload">Request body.</param>
+        /// <param name="headers">Request headers.</param>
+        /// <returns>Deserialized events as they are received.</returns>
+        /// <remarks>On WebGL, events are yielded once the full response has been received.</remarks>
+        public override async IAsyncEnumerable<T> Stream<T> (
+            string method,
+            string path,
+            Dictionary<string, object?>? payload = default,
+            Dictionary<string, string>? headers = default
+        ) where T : class {
+            // Create client
+            using var client = new UnityWebRequest($"{this.url}{path}", method) {
+                disposeDownloadHandlerOnDispose = true,
+                disposeUploadHandlerOnDispose = true,
+            };
+            // Add headers
+            client.SetRequestHeader(@"Accept", @"text/event-stream");
+            if (!string.IsNullOrEmpty(accessKey))
+                client.SetRequestHeader(@"Authorization", $"Bearer {accessKey}");
+            if (headers != null)
+                foreach (var header in headers)
+                    client.SetRequestHeader(header.Key, header.Value);
+            // Add payload
+            string? encoding = null;
+            if (payload != null) {
+                var payloadData = SerializePayload(payload, out encoding);
+                client.SetRequestHeader(@"Content-Type",  @"application/json");
+                if (encoding != null)
+                    client.SetRequestHeader(@"Content-Encoding", encoding);
+                client.uploadHandler = new UploadHandlerRaw(payloadData);
+            }
+            // Stream
+            var parser = new EventStreamParser();
+            var errorBuilder = new StringBuilder();
+            await foreach (var line in ReadLines(client)) {
+                if (client.responseCode >= 400) {
+                    errorBuilder.AppendLine(line);
+                    continue;
+                }
+                var value = parser.Push<T>(line);
+                if (value != null)
+                    yield return value;
+            }
+            // Check error
+            if (encoding != null && RejectCompression((int)client.responseCode)) {
+                await foreach (var value in Stream<T>(method, path, payload, headers))
+                    yield return value;
+                yield break;
+            }
+            if (client.responseCode == 0)
+                throw new FunctionAPIException(
+                    @"Failed to get response from server. Check that you have an internet connection.",
+                    (int)client.responseCode
+                );
+            if (client.responseCode >= 400) {
+                var errorPayload = JsonConvert.DeserializeObject<ErrorResponse>(errorBuilder.ToString());
+                var error = errorPayload?.errors?[0]?.message ?? @"An unknown error occurred";
+                throw new FunctionAPIException(error, (int)client.responseCode);
+            }
+            var last = parser.Flush<T>();
+            if (last != null)
+                yield return last;
+        }
         #endregion
 
 
         #region --Operations--
 
-        private static byte[] ToArray (Stream stream) {
-            if (stream is MemoryStream memoryStream)
-                return memoryStream.ToArray();
-            using var dstStream = new MemoryStream();
-            stream.CopyTo(dstStream);
-            return dstStream.ToArray();
+        private static Task SendWebRequest (UnityWebRequest request) {
+            var tcs = new TaskCompletionSource<bool>();
+            var operation = request.SendWebRequest();
+            operation.completed += _ => tcs.TrySetResult(true); // invoked immediately if already done
+            return tcs.Task;
+        }
+
+        private static async IAsyncEnumerable<string> ReadLines (UnityWebRequest request) {
+            #if UNITY_WEBGL && !UNITY_EDITOR
+            // The browser only hands the response body over once it completes, so buffer it
+            request.downloadHandler = new DownloadHandlerBuffer();
+            await SendWebRequest(request);
+            using var reader = new StringReader(request.downloadHandler.text ?? string.Empty);
+            while (reader.ReadLine() is string line)
+                yield return line;
+            #else
+            var handler = new EventStreamHandler();
+            request.downloadHandler = handler;
+            var operation = request.SendWebRequest();
+            operation.completed += _ => handler.Complete(); // in case the request fails before any content
+            while (await handler.ReadLineAsync() is string line)
+                yield return line;
+            #endif
+        }
+
+        private sealed class EventStreamHandler : DownloadHandlerScript {
+
+            public EventStreamHandler () : base(new byte[16 * 1024]) { }
+
+            public async Task<string?> ReadLineAsync () {
+                await signal.WaitAsync();
+                return lines.TryDequeue(out var line) ? line : null;
+            }
+
+            protected override bool ReceiveData (byte[] data, int length) {
+                var chars = new char[decoder.GetCharCount(data, 0, length)];
+                decoder.GetChars(data, 0, length, chars, 0);
+                foreach (var c in chars) {
+                    if (c == '\n') {
+                        if (buffer.Length > 0 && buffer[buffer.Length - 1] == '\r')
+                            buffer.Length--;
+                        lines.Enqueue(buffer.ToString());
+                        buffer.Clear();
+                        signal.Release();
+                    }
+                    else
+                        buffer.Append(c);
+                }
+                return true;
+            }
+
+            public void Complete () {
+                if (completed)
+                    return;
+                completed = true;
+                if (buffer.Length > 0) {
+                    lines.Enqueue(buffer.ToString());
+                    buffer.Clear();
+                    signal.Release();
+                }
+                signal.Release(); // end of stream
+            }
+
+            protected override void CompleteContent () => Complete();
+
+            private readonly Decoder decoder = Encoding.UTF8.GetDecoder();
+            private readonly StringBuilder buffer = new();
+            private readonly ConcurrentQueue<string> lines = new();
+            private readonly SemaphoreSlim signal = new(0);
+            private bool completed;
+        }
+
+        private static UploadHandler CreateUploadHandler (Stream stream) {
+            // Unity cannot pull upload data from managed code, so anything but a whole file is copied once into native memory
+            if (stream is FileStream fileStream && fileStream.Position == 0)
+                return new UploadHandlerFile(fileStream.Name);
+            if (!stream.CanSeek) {
+                using var buffer = new MemoryStream();
+                stream.CopyTo(buffer);
+                buffer.Position = 0;
+                return CreateUploadHandler(buffer);
+            }
+            var data = new NativeArray<byte>(
+                checked((int)(stream.Length - stream.Position)),
+                Allocator.Persistent,
+                NativeArrayOptions.UninitializedMemory
+            );
+            try {
+                var span = data.AsSpan();
+                if (stream is MemoryStream memoryStream && memoryStream.TryGetBuffer(out var segment))
+                    segment.AsSpan((int)memoryStream.Position, span.Length).CopyTo(span);
+                else
+                    for (int offset = 0, count; offset < span.Length; offset += count)
+                        if ((count = stream.Read(span.Slice(offset))) == 0)
+                            throw new EndOfStreamException(@"Failed to read upload stream because it ended early");
+            } catch {
+                data.Dispose();
+                throw;
+            }
+            return new UploadHandlerRaw(data, true);
         }
         #endregion
     }
@@ -55,7 +55,7 @@ namespace Function {
 
         /// <summary>
         /// Convert a texture to an image.
-        /// NOTE: The texture format must be `R8`, `Alpha8`, `RGB24`, or `RGBA32`.
+        /// NOTE: The texture format must be `R8`, `Alpha8`, `RGB24`, `RGBA32`, or `BGRA32`.
         /// </summary>
         /// <param name="texture">Input texture.</param>
         /// <param name="pixelBuffer">Pixel buffer to store image data. Use this to prevent allocations.</param>
@@ -68,29 +68,32 @@ namespace Function {
                 throw new ArgumentNullException(nameof(texture));
             if (!texture.isReadable)
                 throw new InvalidOperationException(@"Texture cannot be converted to a Function image because it is not readable");
-            var FormatChannelMap = new Dictionary<TextureFormat, int> {
-                [TextureFormat.R8] = 1,
-                [TextureFormat.Alpha8] = 1,
-                [TextureFormat.RGB24] = 3,
-                [TextureFormat.RGBA32] = 4,
+            var FormatMap = new Dictionary<TextureFormat, (PixelFormat format, int bytesPerPixel)> {
+                [TextureFormat.R8] = (PixelFormat.R8, 1),
+                [TextureFormat.Alpha8] = (PixelFormat.R8, 1),
+                [TextureFormat.RGB24] = (PixelFormat.RGB888, 3),
+                [TextureFormat.RGBA32] = (PixelFormat.RGBA8888, 4),
+                [TextureFormat.BGRA32] = (PixelFormat.BGRA8888, 4),
             };
-            if (!FormatChannelMap.TryGetValue(texture.format, out var channels))
+            if (!FormatMap.TryGetValue(texture.format, out var pixelFormat))
                 throw new InvalidOperationException($"Texture cannot be converted to a Function image because it has unsupported format: {texture.format}");
-            var rowStride = texture.width * channels;
-            var bufferSize = rowStride * texture.height;
+            var rawData = texture.GetRawTextureData<byte>();
+            var source = new Image( // Unity textures are stored bottom to top
+                (byte*)rawData.GetUnsafePtr(),
+                texture.width,
+                texture.height,
+                pixelFormat.format,
+                texture.width * pixelFormat.bytesPerPixel,
+                rawData.Length,
+                flip: true
+            );
+            var bufferSize = texture.width * texture.height * source.channels;
             pixelBuffer ??= new byte[bufferSize];
             if (pixelBuffer.Length < bufferSize)
                 throw new InvalidOperationException($"Texture cannot be converted to a Function image because pixel buffer length was expected to be greater than or equal to {bufferSize} but got {pixelBuffer.Length}");
-            fixed (void* dst = pixelBuffer)
-                UnsafeUtility.MemCpyStride(
-                    dst,
-                    rowStride,
-                    (byte*)texture.GetRawTextureData<byte>().GetUnsafePtr() + (rowStride * (texture.height - 1)),
-                    -rowStride,
-                    rowStride,
-                    texture.height
-                );
-            var image = new Image(pixelBuffer, texture.width, texture.height, channels);
+            fixed (byte* dst = pixelBuffer)
+                source.CopyTo(dst);
+            var image = new Image(pixelBuffer, texture.width, texture.height, source.channels);
             return image;
         }
 
@@ -109,6 +112,8 @@ namespace Function {
                 [3] = TextureFormat.RGB24,
                 [4] = TextureFormat.RGBA32
             };
+            if (!image.packed)
+                throw new InvalidOperationException($"Image cannot be converted to a Texture2D because its pixel buffer is not tightly packed: {image.format}");
             if (!ChannelFormatMap.TryGetValue(image.channels, out var format))
                 throw new InvalidOperationException($"Image cannot be converted to a Texture2D because it has unsupported channel count: {image.channels}");
             texture = texture != null ? texture : new Texture2D(image.width, image.height, format, false);
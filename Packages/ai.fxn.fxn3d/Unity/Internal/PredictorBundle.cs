@@ -0,0 +1,211 @@
+/*
+*   Function
+*   Copyright © 2025 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Internal {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Text;
+    using Newtonsoft.Json;
+    using UnityEngine;
+    using Services;
+    using Types;
+
+    /// <summary>
+    /// Embedded predictor bundle.
+    /// A bundle is a single manifest file holding a fixed header and the cached prediction metadata
+    /// for every embedded predictor:
+    ///
+    ///     [0, 16)         Header: magic `FXNB`, version, manifest length.
+    ///     [16, EOF)       UTF-8 JSON manifest.
+    ///
+    /// Resources are stored as loose files in a `cache` directory next to the bundle, so the runtime
+    /// loads them in place without copying them into the resource cache.
+    /// Resources are not packed into the bundle because the Function runtime only loads resources by path.
+    /// When the bundle is written with a framework directory, `dso` resources are not stored in the cache
+    /// directory and instead resolve to the copies which the build handler places in that framework directory.
+    /// </summary>
+    internal sealed class PredictorBundle {
+
+        #region --Client API--
+        /// <summary>
+        /// Bundle file extension.
+        /// </summary>
+        public const string Extension = @".fxnb";
+
+        /// <summary>
+        /// Open a predictor bundle.
+        /// </summary>
+        /// <param name="path">Bundle path.</param>
+        /// <returns>Predictor bundle or `null` if the bundle does not exist or is invalid.</returns>
+        public static PredictorBundle? Open (string path) {
+            if (!File.Exists(path))
+                return null;
+            try {
+                using var stream = File.OpenRead(path);
+                using var reader = new BinaryReader(stream, Encoding.UTF8);
+                if (reader.ReadUInt32() != Magic || reader.ReadUInt32() != Version)
+                    throw new InvalidDataException(@"Predictor bundle has an unsupported format");
+                var manifestLength = reader.ReadInt64();
+                if (manifestLength < 0)
+                    throw new InvalidDataException(@"Predictor bundle manifest has a negative length");
+                var manifestData = reader.ReadBytes(checked((int)manifestLength));
+                if (manifestData.Length != manifestLength)
+                    throw new EndOfStreamException(@"Predictor bundle manifest is truncated");
+                var manifest = JsonConvert.DeserializeObject<Manifest>(Encoding.UTF8.GetString(manifestData));
+                if (manifest?.predictions == null || !manifest.predictions.All(IsValid))
+                    throw new InvalidDataException(@"Predictor bundle manifest is missing predictions or resources");
+                return new PredictorBundle(path, manifest);
+            } catch (Exception ex) when (
+                ex is IOException               ||
+                ex is InvalidDataException      ||
+                ex is JsonException             ||
+                ex is OverflowException         ||
+                ex is ArgumentException
+            ) {
+                Debug.LogWarning($"Function: Ignoring invalid predictor bundle at '{path}' with error: {ex.Message}");
+                return null;
+            }
+        }
+
+        /// <summary>
+        /// Get an embedded prediction whose resources point to the files next to the bundle.
+        /// </summary>
+        /// <param name="tag">Predictor tag.</param>
+        /// <param name="clientId">Client identifier.</param>
+        /// <returns>Cached prediction or `null` if the prediction or any of its resources are missing.</returns>
+        public CachedPrediction? GetPrediction (string tag, string clientId) {
+            var prediction = manifest.predictions.FirstOrDefault(
+                prediction => prediction.tag == tag && prediction.clientId == clientId
+            );
+            if (prediction == null)
+                return null;
+            var resources = prediction.resources.Select(res => new PredictionResource {
+                type = res.type,
+                url = $"file://{GetResourcePath(res)}",
+                name = res.name
+            }).ToArray();
+            if (!resources.All(res => File.Exists(new Uri(res.url).LocalPath)))
+                return null;
+            return new CachedPrediction(prediction, clientId) { resources = resources };
+        }
+
+        /// <summary>
+        /// Get the file name of a `dso` resource in a framework directory.
+        /// </summary>
+        /// <param name="resource">Prediction resource.</param>
+        /// <returns>Framework file name.</returns>
+        public static string GetFrameworkName (PredictionResource resource) => Path.GetFileName(
+            PredictionService.GetResourcePath(resource, string.Empty)
+        );
+        #endregion
+
+
+        #region --Writer--
+        /// <summary>
+        /// Predictor bundle writer.
+        /// </summary>
+        public sealed class Writer : IDisposable {
+
+            /// <summary>
+            /// Create a bundle writer.
+            /// </summary>
+            /// <param name="path">Bundle path.</param>
+            /// <param name="frameworkPath">Directory where the build places `dso` resources, or `null` to store them with the bundle.</param>
+            public Writer (string path, string? frameworkPath = null) {
+                this.path = path;
+                this.resourceRoot = GetResourceRoot(path);
+                this.manifest = new Manifest {
+                    frameworks = frameworkPath != null ?
+                        Path.GetRelativePath(Path.GetDirectoryName(Path.GetFullPath(path)), Path.GetFullPath(frameworkPath)) :
+                        null
+                };
+            }
+
+            /// <summary>
+            /// Add a prediction and its resources to the bundle.
+            /// If opening or reading any resource fails, the bundle is left unchanged and the exception is rethrown.
+            /// </summary>
+            /// <param name="prediction">Cached prediction.</param>
+            /// <param name="openResource">Delegate which opens a resource data stream.</param>
+            public void Add (CachedPrediction prediction, Func<PredictionResource, Stream> openResource) {
+                var written = new List<string>();
+                try {
+                    foreach (var resource in prediction.resources!) {
+                        if (manifest.frameworks != null && resource.type == @"dso")
+                            continue;
+                        var resourcePath = PredictionService.GetResourcePath(resource, resourceRoot);
+                        if (File.Exists(resourcePath))
+                            continue;
+                        Directory.CreateDirectory(Path.GetDirectoryName(resourcePath));
+                        written.Add(resourcePath);
+                        using var dataStream = openResource(resource);
+                        using var fileStream = File.Create(resourcePath);
+                        dataStream.CopyTo(fileStream);
+                    }
+                } catch {
+                    foreach (var resourcePath in written)
+                        File.Delete(resourcePath);
+                    throw;
+                }
+                manifest.predictions.Add(prediction);
+            }
+
+            /// <summary>
+            /// Write the bundle manifest.
+            /// </summary>
+            public void Dispose () {
+                var manifestData = Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(manifest));
+                Directory.CreateDirectory(Path.GetDirectoryName(path));
+                using var stream = File.Create(path);
+                using var writer = new BinaryWriter(stream, Encoding.UTF8);
+                writer.Write(Magic);
+                writer.Write(Version);
+                writer.Write((long)manifestData.Length);
+                writer.Write(manifestData);
+            }
+
+            private readonly string path;
+            private readonly string resourceRoot;
+            private readonly Manifest manifest;
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly string path;
+        private readonly string resourceRoot;
+        private readonly Manifest manifest;
+        private const uint Magic = 0x424E5846; // 'FXNB'
+        private const uint Version = 2;
+
+        private PredictorBundle (string path, Manifest manifest) {
+            this.path = path;
+            this.resourceRoot = GetResourceRoot(path);
+            this.manifest = manifest;
+        }
+
+        private string GetResourcePath (PredictionResource resource) => manifest.frameworks != null && resource.type == @"dso" ?
+            Path.GetFullPath(Path.Combine(Path.GetDirectoryName(path), manifest.frameworks, GetFrameworkName(resource))) :
+            PredictionService.GetResourcePath(resource, resourceRoot);
+
+        private static bool IsValid (CachedPrediction? prediction) =>
+            prediction?.resources != null &&
+            prediction.resources.All(resource => resource?.url != null && Uri.IsWellFormedUriString(resource.url, UriKind.Absolute));
+
+        private static string GetResourceRoot (string path) => Path.Combine(Path.GetDirectoryName(path), @"cache");
+
+        [Preserve, Serializable]
+        private sealed class Manifest {
+            public List<CachedPrediction> predictions = new();
+            public string? frameworks; // relative to the bundle directory
+        }
+        #endregion
+    }
+}
\ No newline at end of file